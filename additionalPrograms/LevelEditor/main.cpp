@@ -50,7 +50,7 @@ int main()
 	sf::Clock deltaClock;
 	sf::Time full_time, dt;
 	
-	Previews::window = &window;
+	Previews previews{ &window };
 
 	while (window.isOpen())
 	{
@@ -129,12 +129,12 @@ int main()
 
 		action_map.update(window);
 		level.ib.update();
-		level.scene.updateScrolling();
+		level.scene.updateScrolling(dt);
 
 		//drawing
 		window.clear();
 		window.draw(level.ib);
-		if (level.level_generator.getGeneration()) level.level_generator.getGeneration()->drawPreview({0.f, (float)window.getSize().y});
+		if (level.level_generator.getGeneration()) level.level_generator.getGeneration()->drawPreview(previews, {0.f, (float)window.getSize().y});
 		ImGui::SFML::Render(window);
 		window.display();
 	}
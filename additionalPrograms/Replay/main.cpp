@@ -0,0 +1,54 @@
+#include <iostream>
+#include <chrono>
+#include <format>
+#include <string>
+
+#include <SFML/Graphics.hpp>
+
+#include <DoodleJumpConfig.hpp>
+#include <common/Resources.hpp>
+#include <level/Level.hpp>
+#include <level/InputRecording.hpp>
+
+
+
+//plays an input recording (made with the Record button of the game) on a headless level and prints where the run ended
+//usage: Replay <recording path>
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "usage: " << argv[0] << " <recording path>\n";
+		return 1;
+	}
+
+	InputRecording recording;
+	if (!recording.loadFromFile(argv[1]))
+	{
+		std::cerr << "can not load the recording " << argv[1] << '\n';
+		return 1;
+	}
+
+	init_resources(true);
+
+	{
+		Level level(recording.target_size);
+		InputReplay replay(level, recording);
+		replay.start();
+
+		auto start = std::chrono::steady_clock::now();
+		while (replay.step());
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		sf::Vector2f doodle_position = level.doodle.getPosition();
+		sf::Vector2f view_center = level.camera.getView().getCenter();
+		std::cout << std::format("ticks: {}, game time: {:.3f}s, real time: {:.3f}s\n", replay.getCurrentTick(), (recording.tick_time * (sf::Int64)replay.getCurrentTick()).asSeconds(), elapsed.count());
+		std::cout << std::format("seed: {}\n", recording.seed);
+		std::cout << std::format("doodle position: {{{}, {}}}, dead: {}\n", doodle_position.x, doodle_position.y, level.doodle.isDead());
+		std::cout << std::format("view center: {{{}, {}}}\n", view_center.x, view_center.y);
+	}
+
+	release_resources();
+
+	return 0;
+}
@@ -0,0 +1,170 @@
+#include <iostream>
+#include <chrono>
+#include <format>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <optional>
+#include <functional>
+
+#include <SFML/Graphics.hpp>
+
+#include <DoodleJumpConfig.hpp>
+#include <common/Resources.hpp>
+#include <common/Random.hpp>
+#include <common/ObjectPool.hpp>
+#include <level/Level.hpp>
+#include <level/InputRecording.hpp>
+#include <level/InputBot.hpp>
+#include <level/BatchRunner.hpp>
+
+
+
+//runs a level headless for a number of ticks and prints how long the phases of Level::update took
+//usage: Benchmark [--ticks N] [--seed S] [--level path] [--replay recording path]
+//without a replay the level is played by the InputBot, with a replay the recorded level, seed and tick time are used
+//with --batch N [--threads T] the seeds S, S + 1, ..., S + N - 1 are run at the same time (see BatchRunner) and their statistics are printed
+//the parts of the game are timed on their own by the Microbenchmarks program
+
+struct PhaseSamples
+{
+	std::string name;
+	std::function<std::chrono::nanoseconds(const Level::UpdatePhaseTimes&)> get;
+	std::vector<std::chrono::nanoseconds> samples{};
+};
+
+double percentileInMicroseconds(std::vector<std::chrono::nanoseconds>& sorted_samples, double percentile)
+{
+	if (sorted_samples.empty()) return 0;
+	size_t index = std::min(sorted_samples.size() - 1, size_t(percentile / 100 * sorted_samples.size()));
+	return std::chrono::duration<double, std::micro>(sorted_samples[index]).count();
+}
+
+int main(int argc, char* argv[])
+{
+	size_t ticks_count = 36000;
+	uint64_t seed = RandomEngine::default_seed;
+	std::string level_path = RESOURCES_PATH"Levels/level0.json";
+	std::optional<std::string> replay_path;
+	size_t batch_size = 0, threads_count = 0;
+	for (int i = 1; i < argc; i += 2)
+	{
+		std::string option = argv[i];
+		if (i + 1 == argc)
+		{
+			std::cerr << "no value for the option " << option << '\n';
+			return 1;
+		}
+		std::string value = argv[i + 1];
+		if (option == "--ticks") ticks_count = std::stoull(value);
+		else if (option == "--seed") seed = std::stoull(value);
+		else if (option == "--level") level_path = value;
+		else if (option == "--replay") replay_path = value;
+		else if (option == "--batch") batch_size = std::stoull(value);
+		else if (option == "--threads") threads_count = std::stoull(value);
+		else
+		{
+			std::cerr << "unknown option " << option << '\n';
+			return 1;
+		}
+	}
+
+	InputRecording recording;
+	if (replay_path && !recording.loadFromFile(*replay_path))
+	{
+		std::cerr << "can not load the recording " << *replay_path << '\n';
+		return 1;
+	}
+
+	init_resources(true);
+
+	if (batch_size)
+	{
+		BatchRunner runner({ .level_path = level_path, .ticks_count = ticks_count, .threads_count = threads_count });
+		std::vector<uint64_t> seeds(batch_size);
+		for (size_t i = 0; i < batch_size; i++) seeds[i] = seed + i;
+
+		auto start = std::chrono::steady_clock::now();
+		std::vector<BatchRunner::SeedStatistics> statistics = runner.run(seeds);
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::cout << std::format("{:<24}{:>12}{:>10}{:>12}{:>12}\n", "seed", "height", "deaths", "max tiles", "time (s)");
+		double runs_time = 0;
+		for (const auto& seed_statistics : statistics)
+		{
+			runs_time += seed_statistics.real_time;
+			std::cout << std::format("{:<24}{:>12.0f}{:>10}{:>12}{:>12.3f}\n", seed_statistics.seed, seed_statistics.max_height, seed_statistics.deaths_count, seed_statistics.max_tiles_count, seed_statistics.real_time);
+		}
+		std::cout << std::format("{} seeds x {} ticks in {:.3f}s ({:.2f}x the time of one thread)\n", batch_size, ticks_count, elapsed.count(), runs_time / elapsed.count());
+	}
+	else
+	{
+		const sf::Vector2u LEVEL_SIZE{ 500, 800 };
+		Level level(replay_path ? recording.target_size : LEVEL_SIZE);
+		InputReplay replay(level, recording);
+		InputBot bot;
+		sf::Time tick_time = sf::seconds(1.f / 120);
+
+		if (replay_path)
+		{
+			replay.start();
+			ticks_count = std::min(ticks_count, recording.ticks.size());
+			tick_time = recording.tick_time;
+		}
+		else
+		{
+			level.loadFromFile(level_path);
+			level.level_generator.setSeed(seed);
+			level.refresh();
+		}
+		level.setMeasuringUpdatePhases(true);
+
+		std::vector<PhaseSamples> phases{
+			{ "generation", [](const Level::UpdatePhaseTimes& t) { return t.generation; } },
+			{ "collisions", [](const Level::UpdatePhaseTimes& t) { return t.collisions; } },
+			{ "scene objects", [](const Level::UpdatePhaseTimes& t) { return t.objects; } },
+			{ "scrolling", [](const Level::UpdatePhaseTimes& t) { return t.scrolling; } },
+			{ "total", [](const Level::UpdatePhaseTimes& t) { return t.total; } }
+		};
+		for (auto& phase : phases) phase.samples.reserve(ticks_count);
+
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < ticks_count; i++)
+		{
+			if (replay_path) replay.step();
+			else
+			{
+				level.applyInput(bot.getInput(level, tick_time), tick_time);
+				level.update(tick_time);
+			}
+			for (auto& phase : phases) phase.samples.push_back(phase.get(level.getLastUpdatePhaseTimes()));
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::cout << std::format("ticks: {}, game time: {:.1f}s, real time: {:.3f}s, {:.0f} ticks/s\n", ticks_count, (tick_time * (sf::Int64)ticks_count).asSeconds(), elapsed.count(), ticks_count / elapsed.count());
+		std::cout << std::format("seed: {}, height: {:.0f}\n", replay_path ? recording.seed : seed, -level.camera.getView().getCenter().y);
+		std::cout << std::format("{:<16}{:>12}{:>12}{:>12}{:>12}{:>12}\n", "phase (us)", "mean", "p50", "p95", "p99", "max");
+		for (auto& phase : phases)
+		{
+			std::sort(phase.samples.begin(), phase.samples.end());
+			std::chrono::nanoseconds sum{};
+			for (auto sample : phase.samples) sum += sample;
+			double mean = phase.samples.empty() ? 0 : std::chrono::duration<double, std::micro>(sum).count() / phase.samples.size();
+			std::cout << std::format("{:<16}{:>12.2f}{:>12.2f}{:>12.2f}{:>12.2f}{:>12.2f}\n", phase.name, mean,
+				percentileInMicroseconds(phase.samples, 50), percentileInMicroseconds(phase.samples, 95), percentileInMicroseconds(phase.samples, 99), percentileInMicroseconds(phase.samples, 100));
+		}
+
+		//once the peaks are reached the slabs stop growing, so a long run allocates no entities from the heap
+		//the slot size is the footprint of one object of the type (its callbacks and animator included, not what they point to)
+		std::cout << std::format("{:<40}{:>10}{:>10}{:>10}{:>10}{:>12}\n", "pool", "live", "peak", "slots", "slabs", "slot size");
+		for (const ObjectPool* pool : ObjectPool::getPools())
+		{
+			ObjectPool::Statistics statistics = pool->getStatistics();
+			std::cout << std::format("{:<40}{:>10}{:>10}{:>10}{:>10}{:>12}\n", statistics.name, statistics.live_count, statistics.peak_count, statistics.slots_count, statistics.slabs_count, statistics.slot_size);
+		}
+	}
+
+	release_resources();
+
+	return 0;
+}
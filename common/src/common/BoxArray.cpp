@@ -0,0 +1,137 @@
+#include "BoxArray.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__AVX2__)
+#define BOX_ARRAY_HAS_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOX_ARRAY_HAS_SSE2
+#endif
+#if defined(BOX_ARRAY_HAS_AVX2) || defined(BOX_ARRAY_HAS_SSE2)
+#include <immintrin.h>
+#endif
+
+BoxArray::Kernel BoxArray::getBestKernel()
+{
+#if defined(BOX_ARRAY_HAS_AVX2)
+	return Kernel::AVX2;
+#elif defined(BOX_ARRAY_HAS_SSE2)
+	return Kernel::SSE2;
+#else
+	return Kernel::Scalar;
+#endif
+}
+
+const char* BoxArray::getKernelName(Kernel kernel)
+{
+	switch (kernel)
+	{
+	case Kernel::SSE2: return "SSE2";
+	case Kernel::AVX2: return "AVX2";
+	default: return "scalar";
+	}
+}
+
+void BoxArray::clear()
+{
+	m_left.clear();
+	m_top.clear();
+	m_right.clear();
+	m_bottom.clear();
+	m_size = 0;
+}
+
+void BoxArray::reserve(size_t size)
+{
+	size = (size + 7) / 8 * 8;
+	m_left.reserve(size);
+	m_top.reserve(size);
+	m_right.reserve(size);
+	m_bottom.reserve(size);
+}
+
+void BoxArray::push_back(sf::FloatRect box)
+{
+	if (m_size == m_left.size())
+	{
+		m_left.resize(m_size + 8);
+		m_top.resize(m_size + 8);
+		m_right.resize(m_size + 8);
+		m_bottom.resize(m_size + 8);
+	}
+	m_left[m_size] = box.left;
+	m_top[m_size] = box.top;
+	m_right[m_size] = box.left + box.width;
+	m_bottom[m_size] = box.top + box.height;
+	m_size++;
+}
+
+size_t BoxArray::size() const
+{
+	return m_size;
+}
+
+bool BoxArray::empty() const
+{
+	return !m_size;
+}
+
+sf::FloatRect BoxArray::operator[](size_t index) const
+{
+	return sf::FloatRect(m_left[index], m_top[index], m_right[index] - m_left[index], m_bottom[index] - m_top[index]);
+}
+
+uint8_t BoxArray::getIntersectionMask(sf::FloatRect query, size_t first, Kernel kernel) const
+{
+	//two boxes intersect when the larger of the lefts is less than the smaller of the rights (and the same vertically), like in sf::FloatRect::intersects
+	float query_left = query.left, query_top = query.top, query_right = query.left + query.width, query_bottom = query.top + query.height;
+	switch (std::min(kernel, getBestKernel()))
+	{
+#if defined(BOX_ARRAY_HAS_AVX2)
+	case Kernel::AVX2:
+	{
+		__m256 left = _mm256_max_ps(_mm256_loadu_ps(&m_left[first]), _mm256_set1_ps(query_left));
+		__m256 top = _mm256_max_ps(_mm256_loadu_ps(&m_top[first]), _mm256_set1_ps(query_top));
+		__m256 right = _mm256_min_ps(_mm256_loadu_ps(&m_right[first]), _mm256_set1_ps(query_right));
+		__m256 bottom = _mm256_min_ps(_mm256_loadu_ps(&m_bottom[first]), _mm256_set1_ps(query_bottom));
+		__m256 hits = _mm256_and_ps(_mm256_cmp_ps(left, right, _CMP_LT_OQ), _mm256_cmp_ps(top, bottom, _CMP_LT_OQ));
+		return uint8_t(_mm256_movemask_ps(hits));
+	}
+#endif
+#if defined(BOX_ARRAY_HAS_SSE2)
+	case Kernel::SSE2:
+	{
+		uint8_t mask = 0;
+		for (size_t half = 0; half < 2; half++)
+		{
+			size_t i = first + half * 4;
+			__m128 left = _mm_max_ps(_mm_loadu_ps(&m_left[i]), _mm_set1_ps(query_left));
+			__m128 top = _mm_max_ps(_mm_loadu_ps(&m_top[i]), _mm_set1_ps(query_top));
+			__m128 right = _mm_min_ps(_mm_loadu_ps(&m_right[i]), _mm_set1_ps(query_right));
+			__m128 bottom = _mm_min_ps(_mm_loadu_ps(&m_bottom[i]), _mm_set1_ps(query_bottom));
+			__m128 hits = _mm_and_ps(_mm_cmplt_ps(left, right), _mm_cmplt_ps(top, bottom));
+			mask |= uint8_t(_mm_movemask_ps(hits) << (half * 4));
+		}
+		return mask;
+	}
+#endif
+	default:
+	{
+		uint8_t mask = 0;
+		for (size_t i = 0; i < 8; i++)
+			if (std::max(m_left[first + i], query_left) < std::min(m_right[first + i], query_right) &&
+				std::max(m_top[first + i], query_top) < std::min(m_bottom[first + i], query_bottom))
+				mask |= uint8_t(1 << i);
+		return mask;
+	}
+	}
+}
+
+void BoxArray::findIntersecting(sf::FloatRect query, std::vector<size_t>& indices, Kernel kernel) const
+{
+	for (size_t first = 0; first < m_size; first += 8)
+		for (uint8_t mask = getIntersectionMask(query, first, kernel); mask; mask &= mask - 1)
+			indices.push_back(first + std::countr_zero(mask));
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+
+#include <SFML/Graphics.hpp>
+
+//collision boxes kept as parallel arrays of their edges, so a query box is tested against many of them at once
+//the intersection is the one of sf::FloatRect::intersects (the boxes must not have negative sizes)
+class BoxArray
+{
+public:
+	//AVX2 tests 8 boxes per instruction and SSE2 4, the kernels that were not compiled in fall back to the best one that was
+	enum class Kernel
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+	static Kernel getBestKernel();
+	static const char* getKernelName(Kernel kernel);
+
+	void clear();
+	void reserve(size_t size);
+	void push_back(sf::FloatRect box);
+	size_t size() const;
+	bool empty() const;
+	sf::FloatRect operator[](size_t index) const;
+
+	//bit i is set if the box first + i intersects the query, first must be a multiple of 8
+	uint8_t getIntersectionMask(sf::FloatRect query, size_t first, Kernel kernel = getBestKernel()) const;
+	//appends the indices of the boxes that intersect the query, in increasing order
+	void findIntersecting(sf::FloatRect query, std::vector<size_t>& indices, Kernel kernel = getBestKernel()) const;
+
+private:
+	//the arrays are padded to a multiple of 8 with empty boxes, which intersect nothing
+	std::vector<float> m_left{}, m_top{}, m_right{}, m_bottom{};
+	size_t m_size{ 0 };
+};
@@ -0,0 +1,135 @@
+#include "Camera.hpp"
+
+Camera::Camera(sf::Vector2u size):
+	m_view(sf::FloatRect{ 0.f, 0.f, (float)size.x, (float)size.y }),
+	m_size(size)
+{
+	updateSnapshot();
+}
+
+Camera::Camera(sf::RenderWindow* window):
+	m_view(window->getView()),
+	m_size(window->getSize()),
+	m_window_ptr(window)
+{
+	updateSnapshot();
+}
+
+void Camera::setView(const sf::View& view)
+{
+	m_view = view;
+	if (m_window_ptr) m_window_ptr->setView(m_view);
+}
+
+const sf::View& Camera::getView() const
+{
+	return m_view;
+}
+
+sf::View Camera::getDefaultView() const
+{
+	sf::Vector2u size = getSize();
+	return sf::View(sf::FloatRect{ 0.f, 0.f, (float)size.x, (float)size.y });
+}
+
+void Camera::setSize(sf::Vector2u size)
+{
+	m_size = size;
+}
+
+sf::Vector2u Camera::getSize() const
+{
+	if (m_window_ptr) return m_window_ptr->getSize();
+	return m_size;
+}
+
+sf::RenderWindow* Camera::getWindow() const
+{
+	return m_window_ptr;
+}
+
+bool Camera::isHeadless() const
+{
+	return !m_window_ptr;
+}
+
+sf::Vector2f Camera::mapPixelToCoords(sf::Vector2i point) const
+{
+	return mapPixelToCoords(point, getViewport(), m_view.getInverseTransform());
+}
+
+sf::Vector2i Camera::mapCoordsToPixel(sf::Vector2f point) const
+{
+	return mapCoordsToPixel(point, getViewport(), m_view.getTransform());
+}
+
+sf::FloatRect Camera::getViewArea() const
+{
+	return getViewArea(getSize(), getViewport(), m_view.getInverseTransform());
+}
+
+Camera::Snapshot Camera::takeSnapshot() const
+{
+	Snapshot snapshot{ m_view, getSize(), getViewport(), m_view.getTransform(), m_view.getInverseTransform() };
+	snapshot.view_area = getViewArea(snapshot.size, snapshot.viewport, snapshot.inverse_transform);
+	return snapshot;
+}
+
+const Camera::Snapshot& Camera::getSnapshot() const
+{
+	return m_snapshot;
+}
+
+void Camera::updateSnapshot()
+{
+	m_snapshot = takeSnapshot();
+}
+
+sf::Vector2f Camera::Snapshot::mapPixelToCoords(sf::Vector2i point) const
+{
+	return Camera::mapPixelToCoords(point, viewport, inverse_transform);
+}
+
+sf::Vector2i Camera::Snapshot::mapCoordsToPixel(sf::Vector2f point) const
+{
+	return Camera::mapCoordsToPixel(point, viewport, transform);
+}
+
+sf::Vector2f Camera::mapPixelToCoords(sf::Vector2i point, sf::IntRect viewport, const sf::Transform& inverse_transform)
+{
+	sf::Vector2f normalized
+	{
+		-1.f + 2.f * (point.x - viewport.left) / viewport.width,
+		 1.f - 2.f * (point.y - viewport.top) / viewport.height
+	};
+	return inverse_transform.transformPoint(normalized);
+}
+
+sf::Vector2i Camera::mapCoordsToPixel(sf::Vector2f point, sf::IntRect viewport, const sf::Transform& transform)
+{
+	sf::Vector2f normalized = transform.transformPoint(point);
+	return sf::Vector2i
+	{
+		static_cast<int>(( normalized.x + 1.f) / 2.f * viewport.width + viewport.left),
+		static_cast<int>((-normalized.y + 1.f) / 2.f * viewport.height + viewport.top)
+	};
+}
+
+sf::FloatRect Camera::getViewArea(sf::Vector2u size, sf::IntRect viewport, const sf::Transform& inverse_transform)
+{
+	sf::Vector2f top_left = mapPixelToCoords({ 0, 0 }, viewport, inverse_transform);
+	return sf::FloatRect{ top_left, mapPixelToCoords(sf::Vector2i{ size }, viewport, inverse_transform) - top_left };
+}
+
+sf::IntRect Camera::getViewport() const
+{
+	sf::Vector2f size{ getSize() };
+	const sf::FloatRect& viewport = m_view.getViewport();
+	return sf::IntRect
+	{
+		static_cast<int>(0.5f + size.x * viewport.left),
+		static_cast<int>(0.5f + size.y * viewport.top),
+		static_cast<int>(0.5f + size.x * viewport.width),
+		static_cast<int>(0.5f + size.y * viewport.height)
+	};
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+//plain viewport/camera object the level simulation reads its view from
+//it can mirror its view to a window, but it can also work without any window (headless mode)
+
+class Camera
+{
+public:
+	//the state of the camera at one moment, with the transforms and the view area already computed
+	//the objects read it many times a tick, so the level takes it once a tick (see Level::update) and it is not recomputed for every one of them
+	struct Snapshot
+	{
+		sf::View view{};
+		sf::Vector2u size{};
+		sf::IntRect viewport{};
+		sf::Transform transform{}, inverse_transform{};
+		sf::FloatRect view_area{};
+
+		sf::Vector2f mapPixelToCoords(sf::Vector2i point) const;
+		sf::Vector2i mapCoordsToPixel(sf::Vector2f point) const;
+	};
+
+	//headless camera with a virtual target of the given size
+	explicit Camera(sf::Vector2u size);
+
+	//camera that mirrors its view to the window and follows the window's size
+	explicit Camera(sf::RenderWindow* window);
+
+	void setView(const sf::View& view);
+	const sf::View& getView() const;
+	sf::View getDefaultView() const;
+
+	void setSize(sf::Vector2u size);
+	sf::Vector2u getSize() const;
+
+	sf::RenderWindow* getWindow() const;
+	bool isHeadless() const;
+
+	//same as sf::RenderTarget's ones, but computed without the target
+	sf::Vector2f mapPixelToCoords(sf::Vector2i point) const;
+	sf::Vector2i mapCoordsToPixel(sf::Vector2f point) const;
+
+	//the area of the world that is currently visible
+	sf::FloatRect getViewArea() const;
+
+	//the current state, computed now
+	Snapshot takeSnapshot() const;
+	//the state when updateSnapshot was last called (or when the camera was made)
+	const Snapshot& getSnapshot() const;
+	void updateSnapshot();
+
+private:
+	sf::IntRect getViewport() const;
+	static sf::Vector2f mapPixelToCoords(sf::Vector2i point, sf::IntRect viewport, const sf::Transform& inverse_transform);
+	static sf::Vector2i mapCoordsToPixel(sf::Vector2f point, sf::IntRect viewport, const sf::Transform& transform);
+	static sf::FloatRect getViewArea(sf::Vector2u size, sf::IntRect viewport, const sf::Transform& inverse_transform);
+
+	sf::View m_view;
+	sf::Vector2u m_size;
+	sf::RenderWindow* m_window_ptr{ nullptr };
+	Snapshot m_snapshot{};
+};
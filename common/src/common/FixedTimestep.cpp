@@ -0,0 +1,90 @@
+#include "FixedTimestep.hpp"
+
+#include <algorithm>
+#include <format>
+
+#include <imgui.h>
+
+FixedTimestep::FixedTimestep(float tick_rate, size_t max_ticks_per_frame):
+	m_max_ticks_per_frame(max_ticks_per_frame)
+{
+	setTickRate(tick_rate);
+}
+
+size_t FixedTimestep::addFrameTime(sf::Time frame_time)
+{
+	m_accumulator += std::max(frame_time, sf::Time::Zero);
+	size_t ticks = m_accumulator.asMicroseconds() / m_tick_time.asMicroseconds();
+	if (ticks > m_max_ticks_per_frame)
+	{
+		m_dropped_ticks_count += ticks - m_max_ticks_per_frame;
+		ticks = m_max_ticks_per_frame;
+		m_accumulator = m_tick_time * (sf::Int64)ticks + m_accumulator % m_tick_time;
+	}
+	m_accumulator -= m_tick_time * (sf::Int64)ticks;
+	m_ticks_count += ticks;
+	return ticks;
+}
+
+sf::Time FixedTimestep::getTickTime() const
+{
+	return m_tick_time;
+}
+
+float FixedTimestep::getAlpha() const
+{
+	return std::clamp(m_accumulator / m_tick_time, 0.f, 1.f);
+}
+
+void FixedTimestep::setTickRate(float tick_rate)
+{
+	m_tick_rate = std::max(tick_rate, 1.f);
+	m_tick_time = sf::microseconds(sf::Int64(1'000'000 / m_tick_rate));
+	m_accumulator = std::min(m_accumulator, m_tick_time);
+}
+
+float FixedTimestep::getTickRate() const
+{
+	return m_tick_rate;
+}
+
+void FixedTimestep::setMaxTicksPerFrame(size_t max_ticks_per_frame)
+{
+	m_max_ticks_per_frame = std::max<size_t>(max_ticks_per_frame, 1);
+}
+
+size_t FixedTimestep::getMaxTicksPerFrame() const
+{
+	return m_max_ticks_per_frame;
+}
+
+size_t FixedTimestep::getTicksCount() const
+{
+	return m_ticks_count;
+}
+
+size_t FixedTimestep::getDroppedTicksCount() const
+{
+	return m_dropped_ticks_count;
+}
+
+void FixedTimestep::reset()
+{
+	m_accumulator = sf::Time::Zero;
+	m_ticks_count = m_dropped_ticks_count = 0;
+}
+
+void FixedTimestep::toImGui()
+{
+	float tick_rate = m_tick_rate;
+	ImGui::Text("Tick rate");
+	ImGui::SameLine();
+	if (ImGui::DragFloat(std::format("##{}", (uintptr_t)&m_tick_rate).c_str(), &tick_rate, 1, 1.f, 1000.f, "%.1f")) setTickRate(tick_rate);
+
+	int max_ticks_per_frame = (int)m_max_ticks_per_frame;
+	ImGui::Text("Max ticks per frame");
+	ImGui::SameLine();
+	if (ImGui::DragInt(std::format("##{}", (uintptr_t)&m_max_ticks_per_frame).c_str(), &max_ticks_per_frame, 1, 1, 1000)) setMaxTicksPerFrame(max_ticks_per_frame);
+
+	ImGui::Text("Ticks: %zu, dropped: %zu", m_ticks_count, m_dropped_ticks_count);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <SFML/System.hpp>
+
+//accumulator for running the simulation with a fixed tick time independently from the frame time
+//the frame time is accumulated and consumed in whole ticks, the remainder is used for interpolating the rendering between the last two ticks
+
+class FixedTimestep
+{
+public:
+	FixedTimestep(float tick_rate = 120, size_t max_ticks_per_frame = 8);
+
+	//adds the (already scaled) frame time and returns how many ticks need to be simulated this frame
+	//if more than the max ticks per frame are needed, the extra time is dropped (the game slows down instead of the frame time spiking)
+	size_t addFrameTime(sf::Time frame_time);
+
+	//the time of a single tick (what should be passed to the updates)
+	sf::Time getTickTime() const;
+
+	//how far the rendered frame is from the previous tick to the current one (0 - previous, 1 - current)
+	float getAlpha() const;
+
+	void setTickRate(float tick_rate);
+	float getTickRate() const;
+	void setMaxTicksPerFrame(size_t max_ticks_per_frame);
+	size_t getMaxTicksPerFrame() const;
+
+	size_t getTicksCount() const;
+	size_t getDroppedTicksCount() const;
+
+	void reset();
+	void toImGui();
+
+private:
+	float m_tick_rate;
+	size_t m_max_ticks_per_frame;
+	sf::Time m_tick_time;
+	sf::Time m_accumulator{};
+	size_t m_ticks_count{}, m_dropped_ticks_count{};
+};
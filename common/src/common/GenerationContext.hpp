@@ -0,0 +1,12 @@
+#pragma once
+
+#include <common/Random.hpp>
+
+//what the generations and the returners need while generating: the level they generate for and its random engine
+//it is passed down the generation tree instead of being stored globally, so every level can generate on its own thread
+struct Level;
+struct GenerationContext
+{
+	Level& level;
+	RandomEngine& random;
+};
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <utility>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+template<class Signature, size_t Capacity = 3 * sizeof(void*)>
+class InplaceFunction;
+
+//like std::function, but the callable is kept in a buffer inside the object, so making, copying and calling it never touches the heap
+//a callable bigger than the buffer does not compile (make the capacity bigger for it), the callbacks of the objects capture this and a pointer or two
+template<class R, class... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+public:
+	InplaceFunction() = default;
+
+	template<class F>
+		requires (!std::same_as<std::remove_cvref_t<F>, InplaceFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+	InplaceFunction(F&& function)
+	{
+		using Callable = std::decay_t<F>;
+		static_assert(sizeof(Callable) <= Capacity, "the callable does not fit in the buffer of the InplaceFunction");
+		static_assert(alignof(Callable) <= alignof(void*), "the buffer is aligned only to pointers");
+		static_assert(std::is_nothrow_move_constructible_v<Callable>, "the callable is moved between the buffers");
+		new (m_storage) Callable(std::forward<F>(function));
+		m_operations = &getOperations<Callable>();
+	}
+
+	InplaceFunction(const InplaceFunction& other)
+	{
+		if (other.m_operations) other.m_operations->copy(m_storage, other.m_storage);
+		m_operations = other.m_operations;
+	}
+
+	InplaceFunction(InplaceFunction&& other) noexcept
+	{
+		if (other.m_operations) other.m_operations->move(m_storage, other.m_storage);
+		m_operations = other.m_operations;
+	}
+
+	InplaceFunction& operator=(const InplaceFunction& other)
+	{
+		if (this != &other)
+		{
+			reset();
+			if (other.m_operations) other.m_operations->copy(m_storage, other.m_storage);
+			m_operations = other.m_operations;
+		}
+		return *this;
+	}
+
+	InplaceFunction& operator=(InplaceFunction&& other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			if (other.m_operations) other.m_operations->move(m_storage, other.m_storage);
+			m_operations = other.m_operations;
+		}
+		return *this;
+	}
+
+	~InplaceFunction()
+	{
+		reset();
+	}
+
+	R operator()(Args... args) const
+	{
+		if (!m_operations) throw std::bad_function_call();
+		return m_operations->invoke(m_storage, std::forward<Args>(args)...);
+	}
+
+	explicit operator bool() const
+	{
+		return m_operations;
+	}
+
+private:
+	//one table for every type of callable, the object keeps only a pointer to it
+	struct Operations
+	{
+		R(*invoke)(void*, Args&&...);
+		void(*copy)(void*, const void*);
+		void(*move)(void*, void*);
+		void(*destroy)(void*);
+	};
+
+	template<class Callable>
+	static const Operations& getOperations()
+	{
+		static constexpr Operations operations
+		{
+			[](void* storage, Args&&... args) -> R { return std::invoke(*static_cast<Callable*>(storage), std::forward<Args>(args)...); },
+			[](void* storage, const void* other) { new (storage) Callable(*static_cast<const Callable*>(other)); },
+			[](void* storage, void* other) { new (storage) Callable(std::move(*static_cast<Callable*>(other))); },
+			[](void* storage) { std::destroy_at(static_cast<Callable*>(storage)); }
+		};
+		return operations;
+	}
+
+	void reset()
+	{
+		if (m_operations) m_operations->destroy(m_storage);
+		m_operations = nullptr;
+	}
+
+	//called through a const object like std::function, so the callable is mutable
+	alignas(void*) mutable std::byte m_storage[Capacity]{};
+	const Operations* m_operations{ nullptr };
+};
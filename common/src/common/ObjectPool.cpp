@@ -0,0 +1,90 @@
+#include "ObjectPool.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+#include <imgui.h>
+
+ObjectPool::ObjectPool(const char* name, size_t slot_size, size_t slots_per_slab):
+	m_name(name),
+	m_slot_size((std::max(slot_size, sizeof(FreeSlot)) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t)),
+	m_slots_per_slab(std::max<size_t>(slots_per_slab, 1))
+{
+	getPoolsForWriting().push_back(this);
+}
+
+ObjectPool::~ObjectPool()
+{
+	std::erase(getPoolsForWriting(), this);
+	//the pool dies with its thread, an object still alive then can not be freed anymore (its delete would reach a dead pool)
+	//so its slabs are leaked on purpose, but not silently, it is a level (or an object) that outlived the thread it was made on
+	if (m_live_count)
+	{
+		std::cerr << "the pool of " << m_name << " is destroyed with " << m_live_count << " live objects, its " << m_slabs.size() << " slabs are leaked\n";
+		return;
+	}
+	for (std::byte* slab : m_slabs) ::operator delete(slab);
+}
+
+void* ObjectPool::allocate()
+{
+	if (!m_free_slots) addSlab();
+	FreeSlot* slot = m_free_slots;
+	m_free_slots = slot->next;
+	m_live_count++;
+	m_peak_count = std::max(m_peak_count, m_live_count);
+	return slot;
+}
+
+void ObjectPool::deallocate(void* ptr)
+{
+	if (!ptr) return;
+	m_free_slots = new (ptr) FreeSlot{ m_free_slots };
+	m_live_count--;
+}
+
+ObjectPool::Statistics ObjectPool::getStatistics() const
+{
+	return Statistics{ m_name, m_slot_size, m_live_count, m_peak_count, m_slabs.size() * m_slots_per_slab, m_slabs.size() };
+}
+
+const std::vector<ObjectPool*>& ObjectPool::getPools()
+{
+	return getPoolsForWriting();
+}
+
+void ObjectPool::statisticsToImGui()
+{
+	if (!ImGui::BeginTable("##ObjectPools", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) return;
+	ImGui::TableSetupColumn("Type");
+	ImGui::TableSetupColumn("Live");
+	ImGui::TableSetupColumn("Peak");
+	ImGui::TableSetupColumn("Slots");
+	ImGui::TableSetupColumn("Slot size");
+	ImGui::TableHeadersRow();
+	for (const ObjectPool* pool : getPools())
+	{
+		Statistics statistics = pool->getStatistics();
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn(); ImGui::Text("%s", statistics.name);
+		ImGui::TableNextColumn(); ImGui::Text("%zu", statistics.live_count);
+		ImGui::TableNextColumn(); ImGui::Text("%zu", statistics.peak_count);
+		ImGui::TableNextColumn(); ImGui::Text("%zu", statistics.slots_count);
+		ImGui::TableNextColumn(); ImGui::Text("%zu", statistics.slot_size);
+	}
+	ImGui::EndTable();
+}
+
+void ObjectPool::addSlab()
+{
+	std::byte* slab = static_cast<std::byte*>(::operator new(m_slot_size * m_slots_per_slab));
+	m_slabs.push_back(slab);
+	//the slots are linked so that the first one is taken first
+	for (size_t i = m_slots_per_slab; i-- > 0;) m_free_slots = new (slab + i * m_slot_size) FreeSlot{ m_free_slots };
+}
+
+std::vector<ObjectPool*>& ObjectPool::getPoolsForWriting()
+{
+	thread_local std::vector<ObjectPool*> pools;
+	return pools;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <new>
+#include <typeinfo>
+
+//fixed size slots taken from slabs of many slots, the freed slots are kept in a free list and reused
+//so once the peak is reached, allocating and freeing an object does not touch the heap
+//every thread has its own pools (the headless levels of the BatchRunner run on many threads), an object must be freed on the thread that allocated it
+class ObjectPool
+{
+public:
+	struct Statistics
+	{
+		const char* name{};
+		size_t slot_size{}, live_count{}, peak_count{}, slots_count{}, slabs_count{};
+	};
+
+	ObjectPool(const char* name, size_t slot_size, size_t slots_per_slab = 64);
+	ObjectPool(const ObjectPool&) = delete;
+	ObjectPool& operator=(const ObjectPool&) = delete;
+	~ObjectPool();
+
+	void* allocate();
+	void deallocate(void* ptr);
+	Statistics getStatistics() const;
+
+	//the pools of the current thread
+	static const std::vector<ObjectPool*>& getPools();
+	//a table of the statistics of the pools of the current thread
+	static void statisticsToImGui();
+
+private:
+	struct FreeSlot
+	{
+		FreeSlot* next;
+	};
+
+	void addSlab();
+	static std::vector<ObjectPool*>& getPoolsForWriting();
+
+	const char* m_name;
+	size_t m_slot_size, m_slots_per_slab;
+	std::vector<std::byte*> m_slabs{};
+	FreeSlot* m_free_slots{ nullptr };
+	size_t m_live_count{ 0 }, m_peak_count{ 0 };
+};
+
+//derive a class from Pooled<itself> to allocate it from its own pool with new (and free it with delete)
+//the classes derived from it that are bigger and not pooled themselves use the normal new
+template<class T>
+class Pooled
+{
+public:
+	static void* operator new(size_t size)
+	{
+		if (size != sizeof(T)) return ::operator new(size);
+		return getPool().allocate();
+	}
+
+	static void operator delete(void* ptr, size_t size)
+	{
+		if (size != sizeof(T)) return ::operator delete(ptr);
+		getPool().deallocate(ptr);
+	}
+
+	static ObjectPool& getPool()
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "the slots are aligned only to max_align_t");
+		thread_local ObjectPool pool(typeid(T).name(), sizeof(T));
+		return pool;
+	}
+};
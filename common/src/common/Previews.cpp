@@ -4,7 +4,7 @@
 #include <SelbaWard/Ring.hpp>
 #include <Thor/Vectors.hpp>
 
-void Previews::point(sf::Vector2f val, sf::Vector2f zero)
+void Previews::point(sf::Vector2f val, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	val.y = -val.y;
@@ -15,7 +15,7 @@ void Previews::point(sf::Vector2f val, sf::Vector2f zero)
 	window->draw(sh);
 }
 
-void Previews::height(float height, sf::Vector2f zero)
+void Previews::height(float height, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	sf::Vector2f
@@ -33,7 +33,7 @@ void Previews::height(float height, sf::Vector2f zero)
 	window->draw(l3);
 }
 
-void Previews::offset(sf::Vector2f offset, sf::Vector2f zero)
+void Previews::offset(sf::Vector2f offset, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	offset.y = -offset.y;
@@ -47,7 +47,7 @@ void Previews::offset(sf::Vector2f offset, sf::Vector2f zero)
 	window->draw(sw::Line(zero + offset, zero + offset - vec, 2, sf::Color::Black));
 }
 
-void Previews::speed(sf::Vector2f speed, sf::Vector2f zero)
+void Previews::speed(sf::Vector2f speed, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	speed.y = -speed.y;
@@ -64,7 +64,7 @@ void Previews::speed(sf::Vector2f speed, sf::Vector2f zero)
 	window->draw(sw::Line(zero + speed - vec2, zero + speed, 2, sf::Color::Black));
 }
 
-void Previews::xBoundary(float boundary, sf::Vector2f zero)
+void Previews::xBoundary(float boundary, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	float bottom_y = window->mapPixelToCoords({ 0, (int)window->getSize().y }).y;
@@ -73,7 +73,7 @@ void Previews::xBoundary(float boundary, sf::Vector2f zero)
 	window->draw(sw::Line({ zero.x + boundary, bottom_y }, { zero.x + boundary, top_y }, 2, sf::Color::Black));
 }
 
-void Previews::yBoundary(float boundary, sf::Vector2f zero)
+void Previews::yBoundary(float boundary, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	boundary = -boundary;
@@ -83,7 +83,7 @@ void Previews::yBoundary(float boundary, sf::Vector2f zero)
 	window->draw(sw::Line({ left_x, zero.y + boundary }, { right_x, zero.y + boundary }, 2, sf::Color::Black));
 }
 
-void Previews::rect(sf::Vector2f half_size, sf::Vector2f zero)
+void Previews::rect(sf::Vector2f half_size, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	half_size.y = -half_size.y;
@@ -96,7 +96,7 @@ void Previews::rect(sf::Vector2f half_size, sf::Vector2f zero)
 	window->draw(sh);
 }
 
-void Previews::circle(float radius, sf::Vector2f zero)
+void Previews::circle(float radius, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 
@@ -108,7 +108,7 @@ void Previews::circle(float radius, sf::Vector2f zero)
 	window->draw(sh);
 }
 
-void Previews::deflect(float max_rotation, sf::Vector2f center, sf::Vector2f zero)
+void Previews::deflect(float max_rotation, sf::Vector2f center, sf::Vector2f zero) const
 {
 	if (!checkWindow()) return;
 	if (center == sf::Vector2f{}) return;
@@ -125,7 +125,7 @@ void Previews::deflect(float max_rotation, sf::Vector2f center, sf::Vector2f zer
 	window->draw(ring);
 }
 
-bool Previews::checkWindow()
+bool Previews::checkWindow() const
 {
 	return window;
 }
\ No newline at end of file
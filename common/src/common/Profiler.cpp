@@ -0,0 +1,213 @@
+#include "Profiler.hpp"
+
+#include <cfloat>
+#include <algorithm>
+#include <fstream>
+#include <format>
+#include <string_view>
+
+#include <imgui.h>
+#include <misc/cpp/imgui_stdlib.h>
+#include <nlohmann/json.hpp>
+
+Profiler::ScopedZone::ScopedZone(const char* name)
+{
+	Profiler& profiler = get();
+	if (!profiler.m_is_enabled || !profiler.m_is_in_frame) return;
+	m_profiler = &profiler;
+	m_zone_index = profiler.beginZone(name);
+}
+
+Profiler::ScopedZone::~ScopedZone()
+{
+	if (m_profiler) m_profiler->endZone(m_zone_index);
+}
+
+Profiler& Profiler::get()
+{
+	thread_local Profiler profiler;
+	return profiler;
+}
+
+void Profiler::setEnabled(bool enabled)
+{
+	m_is_enabled = enabled;
+}
+
+bool Profiler::isEnabled() const
+{
+	return m_is_enabled;
+}
+
+void Profiler::setFramesCapacity(size_t capacity)
+{
+	capacity = std::max<size_t>(capacity, 1);
+	if (capacity == m_frames.size()) return;
+
+	//keeps the newest frames
+	std::vector<Frame> frames(capacity);
+	size_t kept = std::min(capacity, m_frames_count);
+	for (size_t age = 0; age < kept; age++) std::swap(frames[kept - 1 - age], m_frames[(m_next_frame_slot + m_frames.size() - 1 - age) % m_frames.size()]);
+	m_frames = std::move(frames);
+	m_frames_count = kept;
+	m_next_frame_slot = kept % capacity;
+	m_selected_frame_age = std::min(m_selected_frame_age, kept ? kept - 1 : 0);
+}
+
+size_t Profiler::getFramesCapacity() const
+{
+	return m_frames.size();
+}
+
+void Profiler::beginFrame()
+{
+	m_is_in_frame = m_is_enabled;
+	if (!m_is_in_frame) return;
+	m_current_frame.index = m_frame_index++;
+	m_current_frame.start = Clock::now();
+	m_current_frame.zones.clear();
+	m_depth = 0;
+}
+
+void Profiler::endFrame()
+{
+	if (!m_is_in_frame) return;
+	m_is_in_frame = false;
+	m_current_frame.duration = Clock::now() - m_current_frame.start;
+	if (m_is_paused) return;
+
+	//the frame is swapped into the ring, so the zones vector of the oldest frame is reused
+	std::swap(m_frames[m_next_frame_slot], m_current_frame);
+	m_next_frame_slot = (m_next_frame_slot + 1) % m_frames.size();
+	m_frames_count = std::min(m_frames_count + 1, m_frames.size());
+}
+
+size_t Profiler::getFramesCount() const
+{
+	return m_frames_count;
+}
+
+const Profiler::Frame& Profiler::getFrame(size_t age) const
+{
+	return m_frames[(m_next_frame_slot + m_frames.size() - 1 - age) % m_frames.size()];
+}
+
+size_t Profiler::beginZone(const char* name)
+{
+	m_current_frame.zones.push_back(Zone{ name, Clock::now() - m_current_frame.start, {}, m_depth++ });
+	return m_current_frame.zones.size() - 1;
+}
+
+void Profiler::endZone(size_t zone_index)
+{
+	if (m_depth) m_depth--;
+	if (zone_index >= m_current_frame.zones.size()) return;
+	Zone& zone = m_current_frame.zones[zone_index];
+	zone.duration = Clock::now() - m_current_frame.start - zone.start;
+}
+
+bool Profiler::saveChromeTrace(const std::string& path) const
+{
+	std::ofstream fout(path);
+	if (!fout) return false;
+	if (!m_frames_count) return bool(fout << R"({"traceEvents":[]})");
+
+	using Microseconds = std::chrono::duration<double, std::micro>;
+	Clock::time_point origin = getFrame(m_frames_count - 1).start;
+	nl::json events = nl::json::array();
+	for (size_t age = m_frames_count; age-- > 0;)
+	{
+		const Frame& frame = getFrame(age);
+		double frame_start = Microseconds(frame.start - origin).count();
+		events.push_back({ {"name", std::format("Frame {}", frame.index)}, {"ph", "X"}, {"pid", 0}, {"tid", 0}, {"ts", frame_start}, {"dur", Microseconds(frame.duration).count()} });
+		for (const Zone& zone : frame.zones)
+			events.push_back({ {"name", zone.name}, {"ph", "X"}, {"pid", 0}, {"tid", 0}, {"ts", frame_start + Microseconds(zone.start).count()}, {"dur", Microseconds(zone.duration).count()} });
+	}
+	fout << nl::json{ {"traceEvents", std::move(events)}, {"displayTimeUnit", "ms"} };
+	return bool(fout);
+}
+
+bool Profiler::saveCsv(const std::string& path) const
+{
+	std::ofstream fout(path);
+	if (!fout) return false;
+
+	using Microseconds = std::chrono::duration<double, std::micro>;
+	fout << "frame,zone,depth,start_us,duration_us\n";
+	for (size_t age = m_frames_count; age-- > 0;)
+	{
+		const Frame& frame = getFrame(age);
+		fout << std::format("{},\"Frame\",0,0,{:.3f}\n", frame.index, Microseconds(frame.duration).count());
+		for (const Zone& zone : frame.zones)
+			fout << std::format("{},\"{}\",{},{:.3f},{:.3f}\n", frame.index, zone.name, zone.depth + 1, Microseconds(zone.start).count(), Microseconds(zone.duration).count());
+	}
+	return bool(fout);
+}
+
+void Profiler::toImGui()
+{
+	using Milliseconds = std::chrono::duration<float, std::milli>;
+
+	bool enabled = m_is_enabled;
+	if (ImGui::Checkbox("Enabled", &enabled)) setEnabled(enabled);
+	ImGui::SameLine();
+	ImGui::Checkbox("Pause", &m_is_paused);
+	int capacity = (int)getFramesCapacity();
+	ImGui::Text("Frames kept");
+	ImGui::SameLine();
+	if (ImGui::DragInt(std::format("##{}", (uintptr_t)&m_frames).c_str(), &capacity, 10, 1, 100000)) setFramesCapacity(capacity);
+
+	ImGui::InputText(std::format("##{}", (uintptr_t)&m_export_path).c_str(), &m_export_path);
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Save Chrome trace")) saveChromeTrace(m_export_path + ".json");
+	ImGui::SameLine();
+	if (ImGui::SmallButton("Save CSV")) saveCsv(m_export_path + ".csv");
+
+	if (!m_frames_count)
+	{
+		ImGui::Text("No frames");
+		return;
+	}
+
+	//the frame times (the newest is on the right), clicking selects the frame
+	size_t plotted_count = std::min<size_t>(m_frames_count, 300);
+	std::vector<float> frame_times(plotted_count);
+	for (size_t age = 0; age < plotted_count; age++) frame_times[plotted_count - 1 - age] = Milliseconds(getFrame(age).duration).count();
+	ImGui::PlotHistogram(std::format("##{}", (uintptr_t)&m_frames_count).c_str(), frame_times.data(), (int)plotted_count, 0, "frame times (ms)", 0, FLT_MAX, ImVec2(ImGui::GetContentRegionAvail().x, 60));
+	if (ImGui::IsItemHovered() && ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+	{
+		float progress = (ImGui::GetMousePos().x - ImGui::GetItemRectMin().x) / std::max(ImGui::GetItemRectSize().x, 1.f);
+		m_selected_frame_age = plotted_count - 1 - std::clamp<size_t>(size_t(progress * plotted_count), 0, plotted_count - 1);
+	}
+	int selected_frame_age = (int)std::min(m_selected_frame_age, m_frames_count - 1);
+	ImGui::Text("Frame age");
+	ImGui::SameLine();
+	ImGui::SliderInt(std::format("##{}", (uintptr_t)&m_selected_frame_age).c_str(), &selected_frame_age, 0, (int)m_frames_count - 1);
+	m_selected_frame_age = selected_frame_age;
+
+	const Frame& frame = getFrame(m_selected_frame_age);
+	ImGui::Text("Frame %zu: %.3f ms, %zu zones", frame.index, Milliseconds(frame.duration).count(), frame.zones.size());
+
+	//the timeline, a row for every depth
+	uint32_t max_depth = 0;
+	for (const Zone& zone : frame.zones) max_depth = std::max(max_depth, zone.depth);
+	float row_height = ImGui::GetTextLineHeightWithSpacing();
+	float width = std::max(ImGui::GetContentRegionAvail().x, 1.f);
+	ImVec2 origin = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton(std::format("##{}", (uintptr_t)&frame).c_str(), ImVec2(width, row_height * (max_depth + 1)));
+	bool is_hovered = ImGui::IsItemHovered();
+
+	ImDrawList* draw_list = ImGui::GetWindowDrawList();
+	float frame_duration = std::max<float>(float(frame.duration.count()), 1.f);
+	for (const Zone& zone : frame.zones)
+	{
+		ImVec2 min{ origin.x + width * zone.start.count() / frame_duration, origin.y + row_height * zone.depth };
+		ImVec2 max{ std::max(min.x + 1, origin.x + width * (zone.start + zone.duration).count() / frame_duration), min.y + row_height - 1 };
+		float hue = (std::hash<std::string_view>{}(zone.name) % 360) / 360.f;
+		draw_list->AddRectFilled(min, max, ImColor::HSV(hue, 0.5f, 0.8f));
+		draw_list->PushClipRect(min, max, true);
+		draw_list->AddText(ImVec2(min.x + 2, min.y), IM_COL32_BLACK, zone.name);
+		draw_list->PopClipRect();
+		if (is_hovered && ImGui::IsMouseHoveringRect(min, max)) ImGui::SetTooltip("%s\n%.3f ms", zone.name, Milliseconds(zone.duration).count());
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+//lightweight frame profiler, the code marks its zones with PROFILE_SCOPE("name") and the zones of the last frames are kept in a ring buffer
+//every thread has its own profiler (so the headless levels running in parallel do not share it), it is disabled until setEnabled is called
+//when disabled, a zone costs one check
+
+class Profiler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	struct Zone
+	{
+		const char* name{};
+		std::chrono::nanoseconds start{}, duration{}; // start is from the start of the frame
+		uint32_t depth{};
+	};
+
+	struct Frame
+	{
+		size_t index{};
+		Clock::time_point start{};
+		std::chrono::nanoseconds duration{};
+		std::vector<Zone> zones{};
+	};
+
+	//the zone lives from its construction until the end of the scope
+	class ScopedZone
+	{
+	public:
+		ScopedZone(const char* name);
+		~ScopedZone();
+		ScopedZone(const ScopedZone&) = delete;
+		ScopedZone& operator=(const ScopedZone&) = delete;
+
+	private:
+		Profiler* m_profiler{ nullptr };
+		size_t m_zone_index{};
+	};
+
+	//the profiler of the current thread
+	static Profiler& get();
+
+	void setEnabled(bool enabled);
+	bool isEnabled() const;
+	void setFramesCapacity(size_t capacity);
+	size_t getFramesCapacity() const;
+
+	void beginFrame();
+	void endFrame();
+
+	//0 is the last finished frame, 1 the one before it, ...
+	size_t getFramesCount() const;
+	const Frame& getFrame(size_t age) const;
+
+	//chrome://tracing (or Perfetto) format
+	bool saveChromeTrace(const std::string& path) const;
+	//one line per zone: frame, zone, depth, start and duration in microseconds
+	bool saveCsv(const std::string& path) const;
+
+	//the contents of the profiler window: the frame times, the timeline of the selected frame and the export buttons
+	void toImGui();
+
+private:
+	Profiler() = default;
+
+	size_t beginZone(const char* name);
+	void endZone(size_t zone_index);
+
+	bool m_is_enabled{ false }, m_is_in_frame{ false }, m_is_paused{ false };
+	std::vector<Frame> m_frames{ std::vector<Frame>(2000) };
+	size_t m_next_frame_slot{ 0 }, m_frames_count{ 0 }, m_frame_index{ 0 };
+	uint32_t m_depth{ 0 };
+	Frame m_current_frame{};
+
+	size_t m_selected_frame_age{ 0 };
+	std::string m_export_path{ "profile" };
+};
+
+#define PROFILE_SCOPE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(name) Profiler::ScopedZone PROFILE_SCOPE_CONCAT(profile_scope_, __LINE__)(name)
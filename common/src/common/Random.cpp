@@ -0,0 +1,96 @@
+#include "Random.hpp"
+
+#include <cmath>
+#include <numbers>
+
+RandomEngine::RandomEngine(uint64_t seed)
+{
+	this->seed(seed);
+}
+
+void RandomEngine::seed(uint64_t seed)
+{
+	m_seed = seed;
+	m_state = 0;
+	m_increment = (seed << 1u) | 1u;
+	(*this)();
+	m_state += seed;
+	(*this)();
+}
+
+uint64_t RandomEngine::getSeed() const
+{
+	return m_seed;
+}
+
+RandomEngine::result_type RandomEngine::operator()()
+{
+	uint64_t old_state = m_state;
+	m_state = old_state * 6364136223846793005ull + m_increment;
+	uint32_t xorshifted = uint32_t(((old_state >> 18u) ^ old_state) >> 27u);
+	uint32_t rotation = uint32_t(old_state >> 59u);
+	return (xorshifted >> rotation) | (xorshifted << ((~rotation + 1u) & 31u));
+}
+
+float RandomEngine::uniform(float min, float max)
+{
+	return min + (max - min) * next01();
+}
+
+int RandomEngine::uniform(int min, int max)
+{
+	if (max <= min) return min;
+	return int(int64_t(min) + next32(uint32_t(int64_t(max) - min)));
+}
+
+unsigned int RandomEngine::uniform(unsigned int min, unsigned int max)
+{
+	if (max <= min) return min;
+	return min + next32(max - min);
+}
+
+sf::Time RandomEngine::uniform(sf::Time min, sf::Time max)
+{
+	return min + (max - min) * next01();
+}
+
+bool RandomEngine::chance(float chance)
+{
+	return next01() < chance;
+}
+
+sf::Vector2f RandomEngine::rect(sf::Vector2f center, sf::Vector2f half_size)
+{
+	return { uniform(center.x - half_size.x, center.x + half_size.x), uniform(center.y - half_size.y, center.y + half_size.y) };
+}
+
+sf::Vector2f RandomEngine::circle(sf::Vector2f center, float radius)
+{
+	float length = radius * std::sqrt(next01());
+	float angle = uniform(0.f, 2 * std::numbers::pi_v<float>);
+	return center + sf::Vector2f{ length * std::cos(angle), length * std::sin(angle) };
+}
+
+sf::Vector2f RandomEngine::deflect(sf::Vector2f direction, float max_rotation)
+{
+	float angle = uniform(-max_rotation, max_rotation) * std::numbers::pi_v<float> / 180;
+	float cos = std::cos(angle), sin = std::sin(angle);
+	return { cos * direction.x - sin * direction.y, sin * direction.x + cos * direction.y };
+}
+
+RandomEngine RandomEngine::fork()
+{
+	uint64_t high = (*this)();
+	return RandomEngine((high << 32u) | (*this)());
+}
+
+uint32_t RandomEngine::next32(uint32_t range)
+{
+	//maps to [0, range] without division (Lemire's method, the bias is negligible for the game)
+	return uint32_t((uint64_t((*this)()) * (uint64_t(range) + 1)) >> 32u);
+}
+
+float RandomEngine::next01()
+{
+	return ((*this)() >> 8u) * 0x1.0p-24f;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+
+#include <SFML/Graphics.hpp>
+
+//small and fast seedable random engine (PCG32)
+//every level owns its own engines, so a run is reproducible from its seed and several levels can generate at the same time
+//the distributions behave like the thor::Distributions ones they replace
+
+class RandomEngine
+{
+public:
+	using result_type = uint32_t;
+	static constexpr uint64_t default_seed = 0x853c49e6748fea9bull;
+
+	explicit RandomEngine(uint64_t seed = default_seed);
+
+	void seed(uint64_t seed);
+	uint64_t getSeed() const;
+
+	result_type operator()();
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT32_MAX; }
+
+	//uniform in [min, max) for floating point and time, in [min, max] for integers
+	float uniform(float min, float max);
+	int uniform(int min, int max);
+	unsigned int uniform(unsigned int min, unsigned int max);
+	sf::Time uniform(sf::Time min, sf::Time max);
+
+	bool chance(float chance);
+	sf::Vector2f rect(sf::Vector2f center, sf::Vector2f half_size);
+	sf::Vector2f circle(sf::Vector2f center, float radius);
+	sf::Vector2f deflect(sf::Vector2f direction, float max_rotation);
+
+	//creates a new engine seeded from this one (for the objects that need their own random stream)
+	RandomEngine fork();
+
+private:
+	uint64_t m_seed{}, m_state{}, m_increment{};
+	uint32_t next32(uint32_t range);
+	float next01();
+};
@@ -1,6 +1,10 @@
 #include "Resources.hpp"
 
+#include <vector>
+#include <algorithm>
+
 #include <DoodleJumpConfig.hpp>
+#include <common/TextureAtlas.hpp>
 
 sf::Texture& SpriteStat::getTexture()
 {
@@ -12,19 +16,70 @@ sf::Sprite SpriteStat::createSprite()
 	return sf::Sprite(getTexture(), texture_rect);
 }
 
-void init_resources()
+//the sprites of the sheets of the playfield are copied into one atlas and their stats are pointed into it, so the playfield is drawn in one batch
+//the background and the white square keep their own textures, they are repeated
+static void pack_sprites_into_atlas(bool headless)
+{
+	const std::vector<std::string> sheets{ "doodle", "tiles", "items", "monsters" };
+
+	//the sprites in the order of their names (so the atlas is the same in every run), a rect that more sprites share is packed once
+	std::vector<std::string> names;
+	for (const auto& [name, sprite] : global_sprites)
+		if (std::ranges::find(sheets, sprite.texture_name) != sheets.end()) names.push_back(name);
+	std::ranges::sort(names);
+
+	std::vector<std::pair<std::string, sf::IntRect>> rects;
+	std::vector<size_t> rect_indices;
+	for (const auto& name : names)
+	{
+		const SpriteStat& sprite = global_sprites[name];
+		auto itr = std::ranges::find(rects, std::pair{ sprite.texture_name, sprite.texture_rect });
+		rect_indices.push_back(itr - rects.begin());
+		if (itr == rects.end()) rects.emplace_back(sprite.texture_name, sprite.texture_rect);
+	}
+	std::vector<sf::Vector2i> sizes;
+	for (const auto& [sheet, rect] : rects) sizes.emplace_back(rect.width, rect.height);
+	AtlasLayout layout = packIntoAtlas(sizes);
+
+	//when headless only the rects are moved, there are no pixels to copy
+	sf::Image image;
+	if (!headless)
+	{
+		image.create(layout.size.x, layout.size.y, sf::Color::Transparent);
+		std::unordered_map<std::string, sf::Image> sheet_images;
+		for (const auto& sheet : sheets) sheet_images[sheet] = global_textures[sheet].copyToImage();
+		for (size_t i = 0; i < rects.size(); i++) image.copy(sheet_images[rects[i].first], layout.places[i].left, layout.places[i].top, rects[i].second);
+	}
+	global_textures.acquire("atlas", thor::ResourceLoader<sf::Texture>([&image, headless]()
+	{
+		auto texture = std::make_unique<sf::Texture>();
+		if (!headless && !texture->loadFromImage(image)) texture.reset();
+		return texture;
+	}, "atlas"));
+
+	for (size_t i = 0; i < names.size(); i++) global_sprites[names[i]] = SpriteStat{ "atlas", layout.places[rect_indices[i]] };
+	for (const auto& sheet : sheets) global_textures.release(sheet);
+}
+
+void init_resources(bool headless)
 {
-	global_textures.acquire("background", thor::Resources::fromFile<sf::Texture>(RESOURCES_PATH"background.png"));
+	auto load = [headless](const std::string& path)
+	{
+		if (!headless) return thor::Resources::fromFile<sf::Texture>(path);
+		return thor::ResourceLoader<sf::Texture>([]() { return std::make_unique<sf::Texture>(); }, path);
+	};
+
+	global_textures.acquire("background", load(RESOURCES_PATH"background.png"));
 	global_textures["background"].setRepeated(true);
 	global_textures["background"].setSmooth(true);
 
-	global_textures.acquire("empty_white_texture", thor::Resources::fromFile<sf::Texture>(RESOURCES_PATH"empty_white_square.png"));
+	global_textures.acquire("empty_white_texture", load(RESOURCES_PATH"empty_white_square.png"));
 	global_textures["empty_white_texture"].setRepeated(true);
 
-	global_textures.acquire("doodle", thor::Resources::fromFile<sf::Texture>(RESOURCES_PATH"doodle_basic.png"));
-	global_textures.acquire("tiles", thor::Resources::fromFile<sf::Texture>(RESOURCES_PATH"tiles.png"));
-	global_textures.acquire("items", thor::Resources::fromFile<sf::Texture>(RESOURCES_PATH"items.png"));
-	global_textures.acquire("monsters", thor::Resources::fromFile<sf::Texture>(RESOURCES_PATH"monsters.png"));
+	global_textures.acquire("doodle", load(RESOURCES_PATH"doodle_basic.png"));
+	global_textures.acquire("tiles", load(RESOURCES_PATH"tiles.png"));
+	global_textures.acquire("items", load(RESOURCES_PATH"items.png"));
+	global_textures.acquire("monsters", load(RESOURCES_PATH"monsters.png"));
 
 	
 	global_sprites["background"] = SpriteStat{ "background", {0, 0, 528, 829} };
@@ -112,14 +167,13 @@ void init_resources()
 	global_sprites["monsters_the_terrifying_2"] = SpriteStat{ "monsters", { 378, 510, 126, 174 } };
 	global_sprites["monsters_the_terrifying_3"] = SpriteStat{ "monsters", { 504, 510, 134, 174 } };
 	global_sprites["monsters_the_terrifying_4"] = SpriteStat{ "monsters", { 0, 510, 126, 174 } };
+
+	pack_sprites_into_atlas(headless);
 }
 
 void release_resources()
 {
 	global_textures.release("background");
 	global_textures.release("empty_white_texture");
-	global_textures.release("doodle");
-	global_textures.release("tiles");
-	global_textures.release("items");
-	global_textures.release("monsters");
+	global_textures.release("atlas");
 }
\ No newline at end of file
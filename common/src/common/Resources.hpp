@@ -17,5 +17,7 @@ struct SpriteStat
 
 inline std::unordered_map<std::string, SpriteStat> global_sprites;
 
-void init_resources();
+//when headless, the textures are left empty (nothing is loaded), only the sprite rects are set up
+//the sprites of the doodle, tiles, items and monsters sheets are packed into the "atlas" texture (the sheets are released), so their texture is taken from their stats
+void init_resources(bool headless = false);
 void release_resources();
\ No newline at end of file
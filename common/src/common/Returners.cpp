@@ -24,9 +24,9 @@ void toImGui(sf::Vector2f& val)
 
 template<ReturnType RT>
 	requires (RT == Height)
-GeneratedHeightReturner<RT>::ValT GeneratedHeightReturner<RT>::get() const
+GeneratedHeightReturner<RT>::ValT GeneratedHeightReturner<RT>::get(GenerationContext& context) const
 {
-	return -Generation::getCurrentLevelForGenerating()->level_generator.getGeneratedHeight();
+	return -context.level.level_generator.getGeneratedHeight();
 }
 
 void dummy()
@@ -9,11 +9,11 @@
 #include <misc/cpp/imgui_stdlib.h>
 #include <nlohmann/json.hpp>
 #include <SFML/Graphics.hpp>
-#include <Thor/Math/Distributions.hpp>
 
 #include <common/GameStuff.hpp>
 #include <common/Utils.hpp>
 #include <common/Previews.hpp>
+#include <common/GenerationContext.hpp>
 #include <DoodleJumpConfig.hpp>
 
 #define TEXT(x) #x
@@ -102,14 +102,12 @@ const char* getClassName()
 template<ReturnType RT>
 class Returner
 {
-	size_t ImGui_id{ 0 };
-	inline static size_t ImGui_id_counter{ 0 };
 public:
 	using ValT = ValueType<RT>;
 	constexpr static inline ReturnType RetType = RT;
-	Returner() : ImGui_id{ ++ImGui_id_counter } {}
+	Returner() = default;
 
-	ValT getValue() const { return get(); }
+	ValT getValue(GenerationContext& context) const { return get(context); }
 	ValT getMeanValue() const { return getMean(); }
 
 	virtual void to_json(nl::json& j) const
@@ -120,8 +118,7 @@ public:
 	virtual void from_json(const nl::json& j) {}
 	void toImGui()
 	{
-		static size_t id = 0;
-		if (ImGui::TreeNodeEx(std::format("{} (type: {})##{}", getName(), ReturnType_to_text[RT], ImGui_id).c_str(), ImGuiTreeNodeFlags_DefaultOpen))
+		if (ImGui::TreeNodeEx(std::format("{} (type: {})##{}", getName(), ReturnType_to_text[RT], (uintptr_t)this).c_str(), ImGuiTreeNodeFlags_DefaultOpen))
 		{
 			bool canPrev = canPreview();
 			if (!canPrev) ImGui::Text("Can't preview");
@@ -135,21 +132,21 @@ public:
 
 	bool preview{ true };
 
-	void drawPreview(sf::Vector2f offset = sf::Vector2f{}) const
+	void drawPreview(const Previews& previews, sf::Vector2f offset = sf::Vector2f{}) const
 	{
-		drawSubReturnersPreview(offset);
+		drawSubReturnersPreview(previews, offset);
 		if (!preview) return;
-		drawPreviewImpl(offset);
+		drawPreviewImpl(previews, offset);
 	}
 
 	virtual bool canPreview() const { return false; }
 
 protected:
-	virtual ValT get() const { return ValT{}; }
+	virtual ValT get(GenerationContext& context) const { return ValT{}; }
 	virtual ValT getMean() const { return ValT{}; }
 	virtual void toImGuiImpl() {}
-	virtual void drawPreviewImpl(sf::Vector2f offset) const {}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const {}
+	virtual void drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const {}
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const {}
 };
 
 template<class RetT>
@@ -198,25 +195,25 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override { return val; }
+	virtual ValT get(GenerationContext& context) const override { return val; }
 	virtual ValT getMean() const override { return val; }
 	virtual void toImGuiImpl() override
 	{
 		Returner<RT>::toImGuiImpl();
 		ImGui::Text("Value:"); ImGui::SameLine(); ::toImGui(val);
 	}
-	virtual void drawPreviewImpl(sf::Vector2f offset) const override
+	virtual void drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if constexpr (RT == Position) Previews::point(this->getMeanValue(), offset);
-		if constexpr (RT == Height) Previews::height(this->getMeanValue(), offset);
-		if constexpr (RT == XOffset) Previews::offset(sf::Vector2f{ this->getMeanValue(), 0.f }, offset);
-		if constexpr (RT == YOffset) Previews::offset(sf::Vector2f{ 0.f, this->getMeanValue() }, offset);
-		if constexpr (RT == Offset) Previews::offset(this->getMeanValue(), offset);
-		if constexpr (RT == Speed) Previews::speed(this->getMeanValue(), offset);
-		if constexpr (RT == XSpeed) Previews::speed(sf::Vector2f{ this->getMeanValue(), 0.f }, offset);
-		if constexpr (RT == YSpeed) Previews::speed(sf::Vector2f{ 0.f, this->getMeanValue() }, offset);
-		if constexpr (RT == XBoundary) Previews::xBoundary(this->getMeanValue(), offset);
-		if constexpr (RT == YBoundary) Previews::yBoundary(this->getMeanValue(), offset);
+		if constexpr (RT == Position) previews.point(this->getMeanValue(), offset);
+		if constexpr (RT == Height) previews.height(this->getMeanValue(), offset);
+		if constexpr (RT == XOffset) previews.offset(sf::Vector2f{ this->getMeanValue(), 0.f }, offset);
+		if constexpr (RT == YOffset) previews.offset(sf::Vector2f{ 0.f, this->getMeanValue() }, offset);
+		if constexpr (RT == Offset) previews.offset(this->getMeanValue(), offset);
+		if constexpr (RT == Speed) previews.speed(this->getMeanValue(), offset);
+		if constexpr (RT == XSpeed) previews.speed(sf::Vector2f{ this->getMeanValue(), 0.f }, offset);
+		if constexpr (RT == YSpeed) previews.speed(sf::Vector2f{ 0.f, this->getMeanValue() }, offset);
+		if constexpr (RT == XBoundary) previews.xBoundary(this->getMeanValue(), offset);
+		if constexpr (RT == YBoundary) previews.yBoundary(this->getMeanValue(), offset);
 	}
 };
 
@@ -267,9 +264,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override 
+	virtual ValT get(GenerationContext& context) const override 
 	{ 
-		return thor::Distributions::uniform(min_val, max_val)();
+		return context.random.uniform(min_val, max_val);
 	}
 	virtual ValT getMean() const override { return (min_val + max_val) / 2.f; }
 	virtual void toImGuiImpl() override
@@ -278,56 +275,56 @@ protected:
 		ImGui::Text("Min:"); ImGui::SameLine(); ::toImGui(min_val, nullptr, &max_val);
 		ImGui::Text("Max:"); ImGui::SameLine(); ::toImGui(max_val, &min_val);
 	}
-	virtual void drawPreviewImpl(sf::Vector2f offset) const override
+	virtual void drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const override
 	{
 		if constexpr (RT == Height) 
 		{
-			Previews::rect({ 25.f, (max_val - min_val) / 2.f }, offset + sf::Vector2f{ 0.f, -this->getMeanValue() });
-			Previews::height(min_val, offset);
-			Previews::height(max_val, offset);
+			previews.rect({ 25.f, (max_val - min_val) / 2.f }, offset + sf::Vector2f{ 0.f, -this->getMeanValue() });
+			previews.height(min_val, offset);
+			previews.height(max_val, offset);
 		}
 		if constexpr (RT == XOffset) 
 		{
-			Previews::rect({ (max_val - min_val) / 2.f, 10.f }, offset + sf::Vector2f{ this->getMeanValue(), 0.f });
-			Previews::offset({ min_val, 0.f }, offset);
-			Previews::offset({ max_val, 0.f }, offset);
+			previews.rect({ (max_val - min_val) / 2.f, 10.f }, offset + sf::Vector2f{ this->getMeanValue(), 0.f });
+			previews.offset({ min_val, 0.f }, offset);
+			previews.offset({ max_val, 0.f }, offset);
 
 		}
 		if constexpr (RT == YOffset) 
 		{
-			Previews::rect({ 10.f, (max_val - min_val) / 2.f }, offset + sf::Vector2f{ 0.f, -this->getMeanValue() });
-			Previews::offset({ 0.f, min_val }, offset);
-			Previews::offset({ 0.f, max_val }, offset);
+			previews.rect({ 10.f, (max_val - min_val) / 2.f }, offset + sf::Vector2f{ 0.f, -this->getMeanValue() });
+			previews.offset({ 0.f, min_val }, offset);
+			previews.offset({ 0.f, max_val }, offset);
 		}
 		if constexpr (RT == XSpeed) 
 		{
-			Previews::rect({ (max_val - min_val) / 2.f, 10.f }, offset + sf::Vector2f{ this->getMeanValue(), 0.f });
-			Previews::speed({ min_val, 0.f }, offset);
-			Previews::speed({ max_val, 0.f }, offset);
+			previews.rect({ (max_val - min_val) / 2.f, 10.f }, offset + sf::Vector2f{ this->getMeanValue(), 0.f });
+			previews.speed({ min_val, 0.f }, offset);
+			previews.speed({ max_val, 0.f }, offset);
 		}
 		if constexpr (RT == YSpeed) 
 		{
-			Previews::rect({ 10.f, (max_val - min_val) / 2.f }, offset + sf::Vector2f{ 0.f, -this->getMeanValue() });
-			Previews::speed({ 0.f, min_val }, offset);
-			Previews::speed({ 0.f, max_val }, offset);
+			previews.rect({ 10.f, (max_val - min_val) / 2.f }, offset + sf::Vector2f{ 0.f, -this->getMeanValue() });
+			previews.speed({ 0.f, min_val }, offset);
+			previews.speed({ 0.f, max_val }, offset);
 		}
 		if constexpr (RT == XBoundary) 
 		{
-			float bottom_y = Previews::window->mapPixelToCoords({ 0, (int)Previews::window->getSize().y }).y;
-			float top_y = Previews::window->mapPixelToCoords({ 0, 0 }).y;
+			float bottom_y = previews.window->mapPixelToCoords({ 0, (int)previews.window->getSize().y }).y;
+			float top_y = previews.window->mapPixelToCoords({ 0, 0 }).y;
 			float window_view_height = bottom_y - top_y;
-			Previews::rect({ (max_val - min_val) / 2.f, window_view_height / 2.f }, sf::Vector2f{offset.x + this->getMeanValue(), (bottom_y + top_y) / 2.f});
-			Previews::xBoundary(min_val, offset);
-			Previews::xBoundary(max_val, offset);
+			previews.rect({ (max_val - min_val) / 2.f, window_view_height / 2.f }, sf::Vector2f{offset.x + this->getMeanValue(), (bottom_y + top_y) / 2.f});
+			previews.xBoundary(min_val, offset);
+			previews.xBoundary(max_val, offset);
 		}
 		if constexpr (RT == YBoundary)
 		{
-			float right_x = Previews::window->mapPixelToCoords({ (int)Previews::window->getSize().x, 0 }).x;
-			float left_x = Previews::window->mapPixelToCoords({ 0, 0 }).x;
+			float right_x = previews.window->mapPixelToCoords({ (int)previews.window->getSize().x, 0 }).x;
+			float left_x = previews.window->mapPixelToCoords({ 0, 0 }).x;
 			float window_view_width = right_x - left_x;
-			Previews::rect({ window_view_width / 2.f, (max_val - min_val) / 2.f }, sf::Vector2f{ (left_x + right_x) / 2.f, offset.y - this->getMeanValue() });
-			Previews::yBoundary(min_val, offset);
-			Previews::yBoundary(max_val, offset);
+			previews.rect({ window_view_width / 2.f, (max_val - min_val) / 2.f }, sf::Vector2f{ (left_x + right_x) / 2.f, offset.y - this->getMeanValue() });
+			previews.yBoundary(min_val, offset);
+			previews.yBoundary(max_val, offset);
 		}
 	}
 };
@@ -375,9 +372,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return thor::Distributions::rect(center, half_size)();
+		return context.random.rect(center, half_size);
 	}
 	virtual ValT getMean() const override { return center; }
 	virtual void toImGuiImpl() override
@@ -386,12 +383,12 @@ protected:
 		ImGui::Text("Center:"); ImGui::SameLine(); ::toImGui(center);
 		ImGui::Text("Half size:"); ImGui::SameLine(); ::toImGui(half_size);
 	}
-	virtual void drawPreviewImpl(sf::Vector2f offset) const override
+	virtual void drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const override
 	{
-		Previews::rect(half_size, offset + sf::Vector2f{center.x, -center.y});
-		if constexpr (RT == Position) Previews::point(center, offset);
-		if constexpr (RT == Offset) Previews::offset(center, offset);
-		if constexpr (RT == Speed) Previews::speed(center, offset);
+		previews.rect(half_size, offset + sf::Vector2f{center.x, -center.y});
+		if constexpr (RT == Position) previews.point(center, offset);
+		if constexpr (RT == Offset) previews.offset(center, offset);
+		if constexpr (RT == Speed) previews.speed(center, offset);
 	}
 };
 
@@ -439,9 +436,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return thor::Distributions::circle(center, radius)();
+		return context.random.circle(center, radius);
 	}
 	virtual ValT getMean() const override { return center; }
 	virtual void toImGuiImpl() override
@@ -451,12 +448,12 @@ protected:
 		const float min = 0;
 		ImGui::Text("Radius:"); ImGui::SameLine(); ::toImGui(radius, &min);
 	}
-	virtual void drawPreviewImpl(sf::Vector2f offset) const override
+	virtual void drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const override
 	{
-		Previews::circle(radius, offset + sf::Vector2f{ center.x, -center.y });
-		if constexpr (RT == Position) Previews::point(center, offset);
-		if constexpr (RT == Offset) Previews::offset(center, offset);
-		if constexpr (RT == Speed) Previews::speed(center, offset);
+		previews.circle(radius, offset + sf::Vector2f{ center.x, -center.y });
+		if constexpr (RT == Position) previews.point(center, offset);
+		if constexpr (RT == Offset) previews.offset(center, offset);
+		if constexpr (RT == Speed) previews.speed(center, offset);
 	}
 };
 
@@ -504,9 +501,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return thor::Distributions::deflect(direction, max_rotation)();
+		return context.random.deflect(direction, max_rotation);
 	}
 	virtual ValT getMean() const override { return direction; }
 	virtual void toImGuiImpl() override
@@ -516,12 +513,12 @@ protected:
 		const float min = 0;
 		ImGui::Text("Max rotation:"); ImGui::SameLine(); ::toImGui(max_rotation, &min);
 	}
-	virtual void drawPreviewImpl(sf::Vector2f offset) const override
+	virtual void drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const override
 	{
-		Previews::deflect(max_rotation, direction, offset);
-		if constexpr (RT == Position) Previews::point(direction, offset);
-		if constexpr (RT == Offset) Previews::offset(direction, offset);
-		if constexpr (RT == Speed) Previews::speed(direction, offset);
+		previews.deflect(max_rotation, direction, offset);
+		if constexpr (RT == Position) previews.point(direction, offset);
+		if constexpr (RT == Offset) previews.offset(direction, offset);
+		if constexpr (RT == Speed) previews.speed(direction, offset);
 	}
 };
 
@@ -547,8 +544,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override;
-	virtual ValT getMean() const override { return this->getValue(); }
+	virtual ValT get(GenerationContext& context) const override;
+	//the generated height is known only while generating
+	virtual ValT getMean() const override { return ValT{}; }
 };
 
 template<ReturnType RT>
@@ -581,9 +579,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return ret ? -ret->getValue() : ValT{};
+		return ret ? -ret->getValue(context) : ValT{};
 	}
 	virtual ValT getMean() const override
 	{
@@ -594,7 +592,7 @@ protected:
 		Returner<RT>::toImGuiImpl();
 		::toImGui<Returner<RT>>(ret, "Value:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override { if (ret) ret->drawPreview(offset); }
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override { if (ret) ret->drawPreview(previews, offset); }
 };
 
 template <ReturnType RT>
@@ -631,10 +629,10 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		ValT f_val = f_ret ? f_ret->getValue() : ValT{};
-		ValT s_val = s_ret ? s_ret->getValue() : ValT{};
+		ValT f_val = f_ret ? f_ret->getValue(context) : ValT{};
+		ValT s_val = s_ret ? s_ret->getValue(context) : ValT{};
 		return (f_val < s_val) ? f_val : s_val;
 	}
 	virtual ValT getMean() const override
@@ -649,10 +647,10 @@ protected:
 		::toImGui<Returner<RT>>(f_ret, "First:");
 		::toImGui<Returner<RT>>(s_ret, "Second:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if (f_ret) f_ret->drawPreview(offset);
-		if (s_ret) s_ret->drawPreview(offset);
+		if (f_ret) f_ret->drawPreview(previews, offset);
+		if (s_ret) s_ret->drawPreview(previews, offset);
 	}
 };
 
@@ -690,10 +688,10 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		ValT f_val = f_ret ? f_ret->getValue() : ValT{};
-		ValT s_val = s_ret ? s_ret->getValue() : ValT{};
+		ValT f_val = f_ret ? f_ret->getValue(context) : ValT{};
+		ValT s_val = s_ret ? s_ret->getValue(context) : ValT{};
 		return (f_val < s_val) ? s_val : f_val;
 	}
 	virtual ValT getMean() const override
@@ -708,10 +706,10 @@ protected:
 		::toImGui<Returner<RT>>(f_ret, "First:");
 		::toImGui<Returner<RT>>(s_ret, "Second:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if (f_ret) f_ret->drawPreview(offset);
-		if (s_ret) s_ret->drawPreview(offset);
+		if (f_ret) f_ret->drawPreview(previews, offset);
+		if (s_ret) s_ret->drawPreview(previews, offset);
 	}
 };
 
@@ -753,11 +751,11 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		ValT val = ret ? ret->getValue() : ValT{};
-		ValT min_val = min_ret ? min_ret->getValue() : ValT{};
-		ValT max_val = max_ret ? max_ret->getValue() : ValT{};
+		ValT val = ret ? ret->getValue(context) : ValT{};
+		ValT min_val = min_ret ? min_ret->getValue(context) : ValT{};
+		ValT max_val = max_ret ? max_ret->getValue(context) : ValT{};
 		if (max_val < min_val) return val;
 		if (val < min_val) return min_val;
 		if (max_val < val) return max_val;
@@ -780,11 +778,11 @@ protected:
 		::toImGui<Returner<RT>>(min_ret, "Min value:");
 		::toImGui<Returner<RT>>(max_ret, "Max value:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if (ret) ret->drawPreview(offset);
-		if (min_ret) min_ret->drawPreview(offset);
-		if (max_ret) max_ret->drawPreview(offset);
+		if (ret) ret->drawPreview(previews, offset);
+		if (min_ret) min_ret->drawPreview(previews, offset);
+		if (max_ret) max_ret->drawPreview(previews, offset);
 	}
 };
 
@@ -822,9 +820,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return (f_ret ? f_ret->getValue() : ValueType<FRT>{}) + (s_ret ? s_ret->getValue() : ValueType<SRT>{});
+		return (f_ret ? f_ret->getValue(context) : ValueType<FRT>{}) + (s_ret ? s_ret->getValue(context) : ValueType<SRT>{});
 	}
 	virtual ValT getMean() const override
 	{
@@ -836,10 +834,10 @@ protected:
 		::toImGui<Returner<FRT>>(f_ret, "First:");
 		::toImGui<Returner<SRT>>(s_ret, "Second:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if (f_ret) f_ret->drawPreview(offset);
-		if (s_ret) s_ret->drawPreview(offset);
+		if (f_ret) f_ret->drawPreview(previews, offset);
+		if (s_ret) s_ret->drawPreview(previews, offset);
 	}
 };
 
@@ -877,9 +875,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return (f_ret ? f_ret->getValue() : ValueType<FRT>{}) - (s_ret ? s_ret->getValue() : ValueType<SRT>{});
+		return (f_ret ? f_ret->getValue(context) : ValueType<FRT>{}) - (s_ret ? s_ret->getValue(context) : ValueType<SRT>{});
 	}
 	virtual ValT getMean() const override
 	{
@@ -891,10 +889,10 @@ protected:
 		::toImGui<Returner<FRT>>(f_ret, "First:");
 		::toImGui<Returner<SRT>>(s_ret, "Second:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if (f_ret) f_ret->drawPreview(offset);
-		if (s_ret) s_ret->drawPreview(offset);
+		if (f_ret) f_ret->drawPreview(previews, offset);
+		if (s_ret) s_ret->drawPreview(previews, offset);
 	}
 };
 
@@ -932,9 +930,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return (f_ret ? f_ret->getValue() : ValueType<FRT>{}) * (s_ret ? s_ret->getValue() : ValueType<SRT>{});
+		return (f_ret ? f_ret->getValue(context) : ValueType<FRT>{}) * (s_ret ? s_ret->getValue(context) : ValueType<SRT>{});
 	}
 	virtual ValT getMean() const override
 	{
@@ -946,10 +944,10 @@ protected:
 		::toImGui<Returner<FRT>>(f_ret, "First:");
 		::toImGui<Returner<SRT>>(s_ret, "Second:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if (f_ret) f_ret->drawPreview(offset);
-		if (s_ret) s_ret->drawPreview(offset);
+		if (f_ret) f_ret->drawPreview(previews, offset);
+		if (s_ret) s_ret->drawPreview(previews, offset);
 	}
 };
 
@@ -987,9 +985,9 @@ public:
 	}
 
 protected:
-	virtual ValT get() const override
+	virtual ValT get(GenerationContext& context) const override
 	{
-		return (f_ret ? f_ret->getValue() : ValueType<FRT>{}) / (s_ret ? s_ret->getValue() : ValueType<SRT>{});
+		return (f_ret ? f_ret->getValue(context) : ValueType<FRT>{}) / (s_ret ? s_ret->getValue(context) : ValueType<SRT>{});
 	}
 	virtual ValT getMean() const override
 	{
@@ -1001,10 +999,10 @@ protected:
 		::toImGui<Returner<FRT>>(f_ret, "First:");
 		::toImGui<Returner<SRT>>(s_ret, "Second:");
 	}
-	virtual void drawSubReturnersPreview(sf::Vector2f offset) const override
+	virtual void drawSubReturnersPreview(const Previews& previews, sf::Vector2f offset) const override
 	{
-		if (f_ret) f_ret->drawPreview(offset);
-		if (s_ret) s_ret->drawPreview(offset);
+		if (f_ret) f_ret->drawPreview(previews, offset);
+		if (s_ret) s_ret->drawPreview(previews, offset);
 	}
 };
 
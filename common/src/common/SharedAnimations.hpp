@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+#include <memory>
+#include <concepts>
+
+#include <SFML/Graphics.hpp>
+#include <Thor/Animations.hpp>
+
+using SpriteAnimationMap = thor::AnimationMap<sf::Sprite, std::string>;
+
+//the animations that build adds are built the first time and shared (read only) by every object that asks for them after it, the objects keep only their animators
+//the map is kept for every build lambda (so for every place this is called from) and for every thread, the frame animations normalize their frames when they are first played, so they are not shared between the threads
+template<std::invocable<SpriteAnimationMap&> BuildFunctionType>
+std::shared_ptr<const SpriteAnimationMap> getSharedAnimations(BuildFunctionType build)
+{
+	thread_local const std::shared_ptr<const SpriteAnimationMap> animations = [&build]()
+	{
+		auto animations = std::make_shared<SpriteAnimationMap>();
+		build(*animations);
+		return animations;
+	}();
+	return animations;
+}
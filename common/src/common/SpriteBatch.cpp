@@ -0,0 +1,98 @@
+#include "SpriteBatch.hpp"
+
+#include <cmath>
+
+SpriteBatch::SpriteBatch(sf::RenderTarget& target, sf::RenderStates states):
+	m_target(target),
+	m_states(states),
+	m_visible_area(getVisibleArea(target, states.transform)),
+	m_vertices(getVertices())
+{
+	m_vertices.clear();
+}
+
+SpriteBatch::~SpriteBatch()
+{
+	flush();
+}
+
+void SpriteBatch::add(const sf::Sprite& sprite, sf::Vector2f offset)
+{
+	//the same quad as sf::Sprite makes, the texture rect can be flipped by a negative size
+	sf::IntRect rect = sprite.getTextureRect();
+	sf::Vector2f size{ std::abs(float(rect.width)), std::abs(float(rect.height)) };
+	float left = rect.left, top = rect.top, right = left + rect.width, bottom = top + rect.height;
+
+	sf::Transform transform;
+	transform.translate(offset);
+	transform *= sprite.getTransform();
+
+	if (!transform.transformRect({ 0, 0, size.x, size.y }).intersects(m_visible_area))
+	{
+		getStatsForWriting().culled_sprites++;
+		return;
+	}
+	getStatsForWriting().drawn_sprites++;
+
+	if (sprite.getTexture() != m_texture)
+	{
+		flush();
+		m_texture = sprite.getTexture();
+	}
+
+	sf::Color color = sprite.getColor();
+
+	sf::Vertex top_left(transform.transformPoint(0, 0), color, { left, top });
+	sf::Vertex top_right(transform.transformPoint(size.x, 0), color, { right, top });
+	sf::Vertex bottom_right(transform.transformPoint(size.x, size.y), color, { right, bottom });
+	sf::Vertex bottom_left(transform.transformPoint(0, size.y), color, { left, bottom });
+	m_vertices.insert(m_vertices.end(), { top_left, top_right, bottom_right, top_left, bottom_right, bottom_left });
+}
+
+void SpriteBatch::draw(const sf::Drawable& drawable, sf::Vector2f offset)
+{
+	flush();
+	sf::RenderStates states = m_states;
+	states.transform.translate(offset);
+	m_target.draw(drawable, states);
+	getStatsForWriting().draw_calls++;
+}
+
+void SpriteBatch::flush()
+{
+	if (m_vertices.empty()) return;
+	sf::RenderStates states = m_states;
+	states.texture = m_texture;
+	m_target.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states);
+	getStatsForWriting().draw_calls++;
+	m_vertices.clear();
+}
+
+const SpriteBatch::Stats& SpriteBatch::getStats()
+{
+	return getStatsForWriting();
+}
+
+void SpriteBatch::resetStats()
+{
+	getStatsForWriting() = {};
+}
+
+std::vector<sf::Vertex>& SpriteBatch::getVertices()
+{
+	thread_local std::vector<sf::Vertex> vertices;
+	return vertices;
+}
+
+SpriteBatch::Stats& SpriteBatch::getStatsForWriting()
+{
+	thread_local Stats stats{};
+	return stats;
+}
+
+sf::FloatRect SpriteBatch::getVisibleArea(const sf::RenderTarget& target, const sf::Transform& transform)
+{
+	//the inverse transform of the view maps the whole target (from -1 to 1 on both axes) to the world, the bounding box keeps the rotated views
+	sf::Transform to_local = transform.getInverse() * target.getView().getInverseTransform();
+	return to_local.transformRect({ -1, -1, 2, 2 });
+}
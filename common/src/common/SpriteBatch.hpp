@@ -0,0 +1,46 @@
+#pragma once
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+//collects the quads of sprites (two triangles each) and draws the following sprites with the same texture with one draw call
+//the order of drawing is kept, so the sprites of one texture (an atlas) are drawn together until something else is drawn between them
+//the vertices are kept in a buffer of the thread that is reused by all the batches, so what makes its own batch is drawn only through draw (that flushes first)
+//the sprites that are out of the view of the target are culled before they get into the buffer
+class SpriteBatch
+{
+public:
+	//what the batches of the current thread did since the last reset
+	struct Stats
+	{
+		size_t draw_calls{ 0 };
+		size_t drawn_sprites{ 0 };
+		size_t culled_sprites{ 0 };
+	};
+
+	SpriteBatch(sf::RenderTarget& target, sf::RenderStates states);
+	SpriteBatch(const SpriteBatch&) = delete;
+	SpriteBatch& operator=(const SpriteBatch&) = delete;
+	~SpriteBatch();
+
+	//the sprite is drawn moved by the offset, if any part of it is in the view
+	void add(const sf::Sprite& sprite, sf::Vector2f offset = {});
+	//for what is not a sprite, the added sprites are drawn before it
+	void draw(const sf::Drawable& drawable, sf::Vector2f offset = {});
+	void flush();
+
+	static const Stats& getStats();
+	static void resetStats();
+
+private:
+	static std::vector<sf::Vertex>& getVertices();
+	static Stats& getStatsForWriting();
+	//the view of the target in the coordinates the sprites are in (before the transform of the states)
+	static sf::FloatRect getVisibleArea(const sf::RenderTarget& target, const sf::Transform& transform);
+
+	sf::RenderTarget& m_target;
+	sf::RenderStates m_states;
+	sf::FloatRect m_visible_area;
+	const sf::Texture* m_texture{ nullptr };
+	std::vector<sf::Vertex>& m_vertices;
+};
@@ -0,0 +1,41 @@
+#include "TextureAtlas.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+AtlasLayout packIntoAtlas(const std::vector<sf::Vector2i>& sizes, unsigned padding)
+{
+	AtlasLayout layout;
+	layout.places.resize(sizes.size());
+	if (sizes.empty()) return layout;
+
+	unsigned area = 0, widest = 0;
+	for (sf::Vector2i size : sizes)
+	{
+		area += (size.x + 2 * padding) * (size.y + 2 * padding);
+		widest = std::max(widest, size.x + 2 * padding);
+	}
+	unsigned width = 1;
+	while (width < widest || width * width < area) width *= 2;
+
+	std::vector<size_t> order(sizes.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sizes[a].y > sizes[b].y; });
+
+	unsigned x = 0, y = 0, shelf_height = 0;
+	for (size_t i : order)
+	{
+		unsigned padded_width = sizes[i].x + 2 * padding, padded_height = sizes[i].y + 2 * padding;
+		if (x + padded_width > width)
+		{
+			y += shelf_height;
+			x = 0;
+			shelf_height = 0;
+		}
+		layout.places[i] = sf::IntRect(x + padding, y + padding, sizes[i].x, sizes[i].y);
+		x += padded_width;
+		shelf_height = std::max(shelf_height, padded_height);
+	}
+	layout.size = { width, y + shelf_height };
+	return layout;
+}
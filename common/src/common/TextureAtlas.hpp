@@ -0,0 +1,15 @@
+#pragma once
+#include <vector>
+
+#include <SFML/Graphics.hpp>
+
+//the places of rects packed into one texture
+struct AtlasLayout
+{
+	std::vector<sf::IntRect> places{};
+	sf::Vector2u size{};
+};
+
+//the rects are packed on shelves: from the tallest, left to right, and a new shelf is started below when one does not fit the width
+//the width is a power of two, there is padding around every rect so the neighbours do not bleed into each other
+AtlasLayout packIntoAtlas(const std::vector<sf::Vector2i>& sizes, unsigned padding = 1);
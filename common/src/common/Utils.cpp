@@ -1,7 +1,8 @@
 #include "Utils.hpp"
 
 #include <ranges>
-#include <Thor/Math.hpp>
+#include <numeric>
+#include <algorithm>
 
 namespace utils
 {
@@ -15,6 +16,70 @@ namespace utils
 		return sf::Vector2f{ f.x * s.x, f.y * s.y };
 	}
 
+	sf::Vector2f getInterpolationOffset(sf::Vector2f previous, sf::Vector2f current, float alpha)
+	{
+		return (previous - current) * (1 - alpha);
+	}
+
+	std::optional<float> getSweptCollisionTime(sf::FloatRect box, sf::Vector2f displacement, sf::FloatRect target)
+	{
+		if (box.width <= 0 || box.height <= 0 || target.width <= 0 || target.height <= 0) return std::nullopt;
+
+		//the top left corner of the box intersects the target grown by the size of the box, the time is found separately on every axis (the slab method)
+		float from[2]{ box.left - displacement.x, box.top - displacement.y }, by[2]{ displacement.x, displacement.y };
+		float min[2]{ target.left - box.width, target.top - box.height }, max[2]{ target.left + target.width, target.top + target.height };
+		float enter = 0, exit = 1;
+		for (int axis = 0; axis < 2; axis++)
+		{
+			if (by[axis] == 0)
+			{
+				if (from[axis] <= min[axis] || from[axis] >= max[axis]) return std::nullopt;
+				continue;
+			}
+			float first = (min[axis] - from[axis]) / by[axis], second = (max[axis] - from[axis]) / by[axis];
+			if (first > second) std::swap(first, second);
+			enter = std::max(enter, first);
+			exit = std::min(exit, second);
+			if (enter >= exit) return std::nullopt;
+		}
+		return enter;
+	}
+
+	std::vector<size_t> getOrderByTop(const std::vector<sf::FloatRect>& boxes)
+	{
+		std::vector<size_t> order(boxes.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return boxes[a].top < boxes[b].top; });
+		return order;
+	}
+
+	void findIntersectingPairs(const std::vector<sf::FloatRect>& first, const std::vector<sf::FloatRect>& second, std::vector<std::pair<size_t, size_t>>& pairs)
+	{
+		pairs.clear();
+		std::vector<size_t> first_order = getOrderByTop(first), second_order = getOrderByTop(second);
+		std::vector<size_t> first_open, second_open;
+
+		//the boxes are taken from top to bottom, every box is compared with the boxes of the other list that have not ended above its top
+		for (size_t i = 0, j = 0; i < first_order.size() || j < second_order.size();)
+		{
+			if (j == second_order.size() || (i < first_order.size() && first[first_order[i]].top <= second[second_order[j]].top))
+			{
+				const sf::FloatRect& box = first[first_order[i]];
+				std::erase_if(second_open, [&](size_t index) { return second[index].top + second[index].height <= box.top; });
+				for (size_t index : second_open) if (box.intersects(second[index])) pairs.emplace_back(first_order[i], index);
+				first_open.push_back(first_order[i++]);
+			}
+			else
+			{
+				const sf::FloatRect& box = second[second_order[j]];
+				std::erase_if(first_open, [&](size_t index) { return first[index].top + first[index].height <= box.top; });
+				for (size_t index : first_open) if (box.intersects(first[index])) pairs.emplace_back(index, second_order[j]);
+				second_open.push_back(second_order[j++]);
+			}
+		}
+		std::sort(pairs.begin(), pairs.end());
+	}
+
 	float getYFrom5Nums(float x1, float y1, float x2, float y2, float x)
 	{
 		return ((y1 - y2) * x + x1 * y2 - y1 * x2) / (x1 - x2);
@@ -38,20 +103,20 @@ namespace utils
 		return getYFrom5Nums(x1, y1, x2, y2, x);
 	}
 
-	bool getTrueWithChance(float chance)
+	bool getTrueWithChance(RandomEngine& random, float chance)
 	{
-		return thor::Distributions::uniform(0.f, 1.f)() <= chance;
+		return random.chance(chance);
 	}
 
-	float randomSignWithChance(float positive_chance)
+	float randomSignWithChance(RandomEngine& random, float positive_chance)
 	{
-		return getTrueWithChance(positive_chance) ? 1.f : -1.f;
+		return getTrueWithChance(random, positive_chance) ? 1.f : -1.f;
 	}
 	
-	size_t pickOneWithRelativeProbabilities(const std::deque<float>& relative_probabilities)
+	size_t pickOneWithRelativeProbabilities(RandomEngine& random, const std::deque<float>& relative_probabilities)
 	{
 		float sum = std::ranges::fold_left(relative_probabilities, 0, std::plus());
-		float random_val = thor::Distributions::uniform(0.f, sum)();
+		float random_val = random.uniform(0.f, sum);
 		for (size_t i = 0; i < relative_probabilities.size(); i++)
 		{
 			if (random_val <= relative_probabilities[i]) return i;
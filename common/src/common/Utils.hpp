@@ -1,14 +1,26 @@
 #pragma once
 #include <functional>
 #include <deque>
+#include <optional>
+#include <vector>
+#include <utility>
 
 #include <SFML/Graphics.hpp>
 #include <imgui.h>
 #include <nlohmann/json.hpp>
+
+#include <common/Random.hpp>
+
 namespace utils
 {
 	sf::FloatRect getViewArea(const sf::RenderTarget& target);
 	sf::Vector2f element_wiseProduct(sf::Vector2f f, sf::Vector2f s);
+	//offset that moves something drawn at the current position to the interpolated position between the previous and the current ones
+	sf::Vector2f getInterpolationOffset(sf::Vector2f previous, sf::Vector2f current, float alpha);
+	//the time (from 0 to 1) when the box, that got to its current place by moving by the displacement, first intersected the target, nullopt if it did not
+	std::optional<float> getSweptCollisionTime(sf::FloatRect box, sf::Vector2f displacement, sf::FloatRect target);
+	//the intersecting pairs of boxes (index in first, index in second), sorted (sort and sweep on y, so only the boxes that overlap vertically are compared)
+	void findIntersectingPairs(const std::vector<sf::FloatRect>& first, const std::vector<sf::FloatRect>& second, std::vector<std::pair<size_t, size_t>>& pairs);
 	template<class T>
 	sf::Vector2<T> toSFMLVector2(const ImVec2& vec)
 	{
@@ -29,9 +41,9 @@ namespace utils
 	float getYFrom5NumsClamped(float x1, float y1, float x2, float y2, float x);
 	float getYFrom5NumsLeftClamped(float x1, float y1, float x2, float y2, float x);
 	float getYFrom5NumsRightClamped(float x1, float y1, float x2, float y2, float x);
-	bool getTrueWithChance(float chance);
-	float randomSignWithChance(float positive_chance);
-	size_t pickOneWithRelativeProbabilities(const std::deque<float>& relative_probabilities);
+	bool getTrueWithChance(RandomEngine& random, float chance);
+	float randomSignWithChance(RandomEngine& random, float positive_chance);
+	size_t pickOneWithRelativeProbabilities(RandomEngine& random, const std::deque<float>& relative_probabilities);
 
 	bool isMouseHoveringRect(sf::Vector2f coords, sf::Vector2f half_size, const sf::RenderWindow& window);
 }
@@ -1,6 +1,9 @@
 #include "ImageBackground.hpp"
 
+#include <algorithm>
+
 #include <common/Resources.hpp>
+#include <common/Profiler.hpp>
 
 
 ImageBackground::ImageBackground(sf::Texture* texture_ptr, sf::FloatRect background_covering_area)
@@ -81,11 +84,14 @@ void ImageBackground::setTexture(sf::Texture* texture_ptr)
 {
 	if (texture_ptr) m_texture_ptr = texture_ptr;
 	else m_texture_ptr = &global_textures["empty_white_texture"];
+	m_is_geometry_outdated = true;
 }
 
 void ImageBackground::setTextureRect(sf::IntRect texture_rect)
 {
 	m_texture_rect = texture_rect;
+	m_is_needed_sprites_outdated = true;
+	m_is_geometry_outdated = true;
 }
 
 void ImageBackground::setBackgroundCoveringArea(sf::FloatRect background_covering_area)
@@ -106,6 +112,7 @@ void ImageBackground::setBackgroundCoveringArea(sf::RenderTarget* background_tar
 void ImageBackground::setColor(sf::Color color)
 {
 	m_color = color;
+	m_is_geometry_outdated = true;
 }
 
 void ImageBackground::setMovingTo0(bool enabled)
@@ -150,9 +157,19 @@ bool ImageBackground::getMovingTo0() const
 
 void ImageBackground::update_impl() const
 {
+	auto [background_covering_area, background_covering_area_rotation] = m_get_background_covering_area();
+	const float* matrix = getTransform().getMatrix();
+	if (!m_is_needed_sprites_outdated &&
+		background_covering_area == m_last_covering_area &&
+		background_covering_area_rotation == m_last_covering_area_rotation &&
+		std::equal(m_last_transform_matrix.begin(), m_last_transform_matrix.end(), matrix)) return;
+	m_last_covering_area = background_covering_area;
+	m_last_covering_area_rotation = background_covering_area_rotation;
+	std::copy(matrix, matrix + 16, m_last_transform_matrix.begin());
+	m_is_needed_sprites_outdated = false;
+
 	//transforms the corner points of the background area to the image "space"
 	sf::Transform inv_tr = getInverseTransform();
-	auto [background_covering_area, background_covering_area_rotation] = m_get_background_covering_area();
 	sf::Transform tr;
 	tr.translate(background_covering_area.left + background_covering_area.width / 2.f, background_covering_area.top + background_covering_area.height / 2.0);
 	tr.rotate(background_covering_area_rotation);
@@ -186,6 +203,45 @@ void ImageBackground::update_impl() const
 	m_needed_sprites.width = right - left;
 }
 
+void ImageBackground::updateGeometry() const
+{
+	sf::Vector2i size{ m_needed_sprites.width, m_needed_sprites.height };
+	if (!m_is_geometry_outdated && size == m_geometry_size && m_texture_ptr->isRepeated() == m_is_geometry_repeated) return;
+	m_geometry_size = size;
+	m_is_geometry_repeated = m_texture_ptr->isRepeated();
+	m_is_geometry_outdated = false;
+
+	auto set_quad = [this](size_t index, sf::FloatRect place, sf::FloatRect texture_rect)
+	{
+		sf::Vertex* quad = &m_geometry[index * 6];
+		sf::Vector2f top_left{ place.left, place.top }, top_right{ place.left + place.width, place.top };
+		sf::Vector2f bottom_right{ place.left + place.width, place.top + place.height }, bottom_left{ place.left, place.top + place.height };
+		sf::Vector2f tex_top_left{ texture_rect.left, texture_rect.top }, tex_top_right{ texture_rect.left + texture_rect.width, texture_rect.top };
+		sf::Vector2f tex_bottom_right{ texture_rect.left + texture_rect.width, texture_rect.top + texture_rect.height }, tex_bottom_left{ texture_rect.left, texture_rect.top + texture_rect.height };
+		quad[0] = sf::Vertex(top_left, m_color, tex_top_left);
+		quad[1] = sf::Vertex(top_right, m_color, tex_top_right);
+		quad[2] = sf::Vertex(bottom_right, m_color, tex_bottom_right);
+		quad[3] = quad[0];
+		quad[4] = quad[2];
+		quad[5] = sf::Vertex(bottom_left, m_color, tex_bottom_left);
+	};
+
+	sf::Vector2f image_size(m_texture_rect.width, m_texture_rect.height);
+	//with a repeated texture one quad covers all the images, otherwise every image is its own quad with the same texture rect
+	if (m_is_geometry_repeated)
+	{
+		sf::FloatRect whole{ 0, 0, size.x * image_size.x, size.y * image_size.y };
+		m_geometry.resize(6);
+		set_quad(0, whole, whole);
+	}
+	else
+	{
+		m_geometry.resize(size_t(size.x) * size.y * 6);
+		for (int i = 0; i < size.y; i++) for (int j = 0; j < size.x; j++)
+			set_quad(size_t(i) * size.x + j, { j * image_size.x, i * image_size.y, image_size.x, image_size.y }, sf::FloatRect(m_texture_rect));
+	}
+}
+
 void ImageBackground::setBackgroundSetGetters(sf::FloatRect background_covering_area)
 {
 	m_background_covering_area = background_covering_area;
@@ -224,25 +280,10 @@ void ImageBackground::setBackgroundSetGetters(sf::RenderTarget* background_targe
 
 void ImageBackground::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+	PROFILE_SCOPE("ImageBackground::draw");
+	updateGeometry();
 	states.transform *= getTransform();
-	sf::IntRect texture_rect = (m_texture_ptr->isRepeated() ?
-								sf::IntRect(0, 0, 
-											m_needed_sprites.width * m_texture_rect.width,
-											m_needed_sprites.height * m_texture_rect.height) :
-								m_texture_rect);
-	sf::Sprite sp(*m_texture_ptr, texture_rect);
-	sp.setColor(m_color);
-	if(m_texture_ptr->isRepeated()) 
-	{
-		sp.setPosition(m_needed_sprites.left * m_texture_rect.width, m_needed_sprites.top * m_texture_rect.height);
-		target.draw(sp, states);
-	}
-	else
-	{
-		for (int i = m_needed_sprites.top; i < m_needed_sprites.top + m_needed_sprites.height; i++) for (int j = m_needed_sprites.left; j < m_needed_sprites.left + m_needed_sprites.width; j++)
-		{
-			sp.setPosition(j * m_texture_rect.width, i * m_texture_rect.height);
-			target.draw(sp, states);
-		}
-	}
+	states.transform.translate(m_needed_sprites.left * m_texture_rect.width, m_needed_sprites.top * m_texture_rect.height);
+	states.texture = m_texture_ptr;
+	target.draw(m_geometry, states);
 }
@@ -1,11 +1,12 @@
 #pragma once
 
+#include <array>
 #include <functional>
 #include <SFML/Graphics.hpp>
 #include <nlohmann/json.hpp>
 
 //class that renders a background for some area filling everything with an image independently from rotation scale or position of the image
-//If you're going to use big zoom factor for your window's view, it'll be very good for your memory and framerate to use texture with repeating enabled (class can optimise its work)
+//the images are drawn as one cached mesh with one draw call, with a repeated texture the mesh is one quad (better for big zoom factors, the mesh of other textures grows with the count of the images)
 
 class ImageBackground : public sf::Transformable, public sf::Drawable
 {
@@ -88,7 +89,20 @@ private:
 	//represents where to draw image, and how many of them needed
 	mutable sf::IntRect m_needed_sprites;
 
+	//the area and the transform m_needed_sprites was computed for, it is computed again only when one of them changes
+	mutable sf::FloatRect m_last_covering_area{};
+	mutable float m_last_covering_area_rotation{ 0 };
+	mutable std::array<float, 16> m_last_transform_matrix{};
+	mutable bool m_is_needed_sprites_outdated{ true };
+
+	//all the needed images as one mesh, built for the count of the images (not their place), so it is built again only when the size or the rotation of the area changes
+	mutable sf::VertexArray m_geometry{ sf::Triangles };
+	mutable sf::Vector2i m_geometry_size{};
+	mutable bool m_is_geometry_repeated{ false };
+	mutable bool m_is_geometry_outdated{ true };
+
 	void update_impl() const;
+	void updateGeometry() const;
 
 	//sets the functions needed to get or set the bacground area and its rotations (if needed)
 	void setBackgroundSetGetters(sf::FloatRect background_covering_area);
@@ -2,10 +2,13 @@
 #include <type_traits>
 #include <numbers>
 #include <cmath>
+#include <typeinfo>
+#include <algorithm>
 
 #include <imgui.h>
 
 #include <common/DebugImGui.hpp>
+#include <common/Profiler.hpp>
 
 SimpleView::SimpleView()
 {
@@ -176,77 +179,43 @@ ViewScrolling::ViewScrolling(sf::Time duration) :
 	m_duration(duration)
 {}
 
-Scene::Object::Object(std::shared_ptr<const size_t*> scene_identifier) :
+Scene::Object::Object(size_t scene_identifier, uint32_t index, uint32_t generation) :
 	scene_identifier(scene_identifier),
-	identifier(identifier_counter++)
+	index(index),
+	generation(generation)
 {}
 
-Scene::Object::Object(const Object& other) :
-	scene_identifier(other.scene_identifier),
-	drawable_ptr(other.drawable_ptr),
-	update(other.update),
-	identifier(other.identifier)
-{}
-
-Scene::Object Scene::Object::get_duplicate() const
-{
-	Object obj(*this);
-	obj.identifier = Object::identifier_counter++;
-	return obj;
-}
-
-bool Scene::Object::operator==(Object other) const
-{
-	return std::tie(scene_identifier, drawable_ptr, identifier) == std::tie(other.scene_identifier, other.drawable_ptr, other.identifier);
-}
-
 Scene::Scene()
 {
 	setScrollingType(InstantScrolling());
 }
 
-Scene::~Scene()
+void Scene::setCamera(Camera* camera)
 {
-	for (auto& obj : m_objects) (*obj.scene_identifier) = nullptr;
+	m_camera_ptr = camera;
+	m_view = m_view_destination = camera->getDefaultView();
 }
 
-void Scene::setWindow(sf::RenderWindow* window)
+Camera* Scene::getCamera() const
 {
-	m_window_ptr = window;
-	m_view = m_view_destination = window->getDefaultView();
-}
-
-sf::RenderWindow* Scene::getWindow() const
-{
-	return m_window_ptr;
-}
-
-size_t Scene::Object::Hasher::operator()(const Object& obj) const
-{
-	return std::_Hash_array_representation<char>((char*)&obj, sizeof(Object));
+	return m_camera_ptr;
 }
 
 bool Scene::removeObject(Object obj)
 {
-	if (!isMyObject(obj)) return false;
-	if (!removeFromUpdateList(obj)) return false;
-	if (!removeFromDrawList(obj)) return false;;
-	(*obj.scene_identifier) = nullptr;
-	m_objects.erase(obj);
+	Slot* slot = getSlot(obj);
+	if (!slot) return false;
+	removeFromUpdateList(obj);
+	removeFromDrawList(obj);
+	//the next object in the slot gets the next generation
+	*slot = Slot{ .generation = slot->generation + 1 };
+	m_free_slots.push_back(obj.index);
 	return true;
 }
 
 bool Scene::moveObjectUpInUpdateOrder(Object obj, int count)
 {
-	if (!isMyObject(obj)) return false;
-	size_t pos = getObjectsItrForUpdateList(obj) - m_update_order.begin();
-	if (pos == m_update_order.size()) return false;
-
-	m_update_order.erase(m_update_order.begin() + pos);
-	pos += count;
-	pos = std::clamp<size_t>(pos, 0, m_update_order.size());
-	m_update_order.insert(m_update_order.begin() + pos, obj);
-	return true;
+	return moveInList(m_update_order, &Slot::update_position, obj, count);
 }
 
 bool Scene::moveObjectDownInUpdateOrder(Object obj, int count)
@@ -266,39 +235,23 @@ bool Scene::updateLast(Object obj)
 
 bool Scene::addToUpdateList(Object obj, int position)
 {
-	if (!isMyObject(obj)) return false;
-	if (isInUpdateList(obj)) return false;
-	if (position < 0) position += m_update_order.size() + 1;
-	position = std::clamp<int>(position, 0, m_update_order.size());
-	m_update_order.insert(m_update_order.begin() + position, obj);
-	return true;
+	return insertIntoList(m_update_order, &Slot::update_position, obj, position);
 }
 
 bool Scene::isInUpdateList(Object obj)
 {
-	return getObjectsItrForUpdateList(obj) != m_update_order.end();
+	Slot* slot = getSlot(obj);
+	return slot && slot->update_position != npos;
 }
 
 bool Scene::removeFromUpdateList(Object obj)
 {
-	if (!isMyObject(obj)) return false;
-	auto itr = getObjectsItrForUpdateList(obj);
-	if (itr == m_update_order.end()) return false;
-	m_update_order.erase(itr);
-	return true;
+	return eraseFromList(m_update_order, &Slot::update_position, obj);
 }
 
 bool Scene::moveObjectUpInDrawOrder(Object obj, int count)
 {
-	if (!isMyObject(obj)) return false;
-	size_t pos = getObjectsItrForDrawList(obj) - m_draw_order.begin();
-	if (pos == m_draw_order.size()) return false;
-
-	m_draw_order.erase(m_draw_order.begin() + pos);
-	pos += count;
-	pos = std::clamp<size_t>(pos, 0, m_draw_order.size());
-	m_draw_order.insert(m_draw_order.begin() + pos, obj);
-	return true;
+	return moveInList(m_draw_order, &Slot::draw_position, obj, count);
 }
 
 bool Scene::moveObjectDownInDrawOrder(Object obj, int count)
@@ -318,26 +271,18 @@ bool Scene::drawLast(Object obj)
 
 bool Scene::addToDrawList(Object obj, int position)
 {
-	if (!isMyObject(obj)) return false;
-	if (isInDrawList(obj))return false;
-	if (position < 0) position += m_draw_order.size() + 1;
-	position = std::clamp<int>(position, 0, m_draw_order.size());
-	m_draw_order.insert(m_draw_order.begin() + position, obj);
-	return true;
+	return insertIntoList(m_draw_order, &Slot::draw_position, obj, position);
 }
 
 bool Scene::isInDrawList(Object obj)
 {
-	return getObjectsItrForDrawList(obj) != m_draw_order.end();
+	Slot* slot = getSlot(obj);
+	return slot && slot->draw_position != npos;
 }
 
 bool Scene::removeFromDrawList(Object obj)
 {
-	if (!isMyObject(obj)) return false;
-	auto itr = getObjectsItrForDrawList(obj);
-	if (itr == m_draw_order.end()) return false;
-	m_draw_order.erase(itr);
-	return true;
+	return eraseFromList(m_draw_order, &Slot::draw_position, obj);
 }
 
 void Scene::scrollUp(float offset, bool instant)
@@ -369,7 +314,7 @@ void Scene::scroll(sf::Vector2f offset, bool instant)
 {
 	m_in_scroll = true;
 	if (!instant) m_view = getCurrentView();
-	m_scroll_timer.restart();
+	m_scroll_time = sf::Time::Zero;
 	m_view_destination.move(offset);
 	if (instant) m_view = m_view_destination;
 }
@@ -398,7 +343,7 @@ void Scene::zoom(sf::Vector2f scale, bool instant)
 {
 	m_in_scroll = true;
 	if (!instant) m_view = getCurrentView();
-	m_scroll_timer.restart();
+	m_scroll_time = sf::Time::Zero;
 	sf::Vector2f size = m_view_destination.getSize();
 	size.x /= scale.x;
 	size.y /= scale.y;
@@ -411,74 +356,113 @@ void Scene::rotate(float angle, bool instant)
 
 	m_in_scroll = true;
 	if (!instant) m_view = getCurrentView();
-	m_scroll_timer.restart();
+	m_scroll_time = sf::Time::Zero;
 	m_view_destination.rotate(angle);
 	if (instant) m_view = m_view_destination;
 }
 
 void Scene::updateObjects(sf::Time dt)
 {
-	for (int i = 0; i < m_update_order.size(); i++)
+	PROFILE_SCOPE("Scene::updateObjects");
+	for (size_t i = 0; i < m_update_order.size(); i++)
 	{
-		if (isMyObject(m_update_order[i])) m_update_order[i].update(dt);
-		else m_update_order.erase(m_update_order.begin() + i--);
+		Slot& slot = m_slots[m_update_order[i]];
+		//every object is its own zone, named after its type
+		PROFILE_SCOPE(typeid(*slot.drawable_ptr).name());
+		slot.update(dt);
 	}
 }
 
-void Scene::updateScrolling()
+void Scene::updateScrolling(sf::Time dt)
 {
 	if (m_in_scroll)
 	{
-		sf::Time passed_time = m_scroll_timer.getElapsedTime();
+		m_scroll_time += dt;
 		SimpleView view = getCurrentView();
-		if (passed_time > m_scrolling_type_ptr->getDuration()) m_in_scroll = false;
-		m_window_ptr->setView(view.asSFMLView());
+		if (m_scroll_time > m_scrolling_type_ptr->getDuration()) m_in_scroll = false;
+		m_camera_ptr->setView(view.asSFMLView());
 	}
 	else m_view = m_view_destination;
 }
 
 SimpleView Scene::getCurrentView() const
 {
-	return m_scrolling_type_ptr->getView(m_scroll_timer.getElapsedTime(), m_view, m_view_destination);
+	return m_scrolling_type_ptr->getView(m_scroll_time, m_view, m_view_destination);
 
 }
 
-std::deque<Scene::Object>::iterator Scene::getObjectsItrForUpdateList(Object obj)
+Scene::Object Scene::createObject(sf::Drawable& drawable, UpdateFunctionType update)
 {
-	if (!isMyObject(obj)) return m_update_order.end();
-	return std::find(m_update_order.begin(), m_update_order.end(), obj);
+	uint32_t index;
+	if (m_free_slots.empty())
+	{
+		index = m_slots.size();
+		m_slots.emplace_back();
+	}
+	else
+	{
+		index = m_free_slots.back();
+		m_free_slots.pop_back();
+	}
+	Slot& slot = m_slots[index];
+	slot.drawable_ptr = &drawable;
+	slot.update = std::move(update);
+	slot.is_alive = true;
+	return Object(m_identifier, index, slot.generation);
 }
 
-std::deque<Scene::Object>::iterator Scene::getObjectsItrForDrawList(Object obj)
+Scene::Slot* Scene::getSlot(Object obj)
 {
-	if (!isMyObject(obj)) return m_draw_order.end();
-	return std::find(m_draw_order.begin(), m_draw_order.end(), obj);
+	if (obj.scene_identifier != m_identifier || obj.index >= m_slots.size()) return nullptr;
+	Slot& slot = m_slots[obj.index];
+	if (!slot.is_alive || slot.generation != obj.generation) return nullptr;
+	return &slot;
 }
 
-std::deque<Scene::Object>::const_iterator Scene::getObjectsItrForUpdateList(Object obj) const
+bool Scene::insertIntoList(List& list, Position position_in_list, Object obj, int position)
 {
-	if (!isMyObject(obj)) return m_update_order.end();
-	return std::find(m_update_order.begin(), m_update_order.end(), obj);
+	Slot* slot = getSlot(obj);
+	if (!slot || slot->*position_in_list != npos) return false;
+	if (position < 0) position += list.size() + 1;
+	position = std::clamp<int>(position, 0, list.size());
+	list.insert(list.begin() + position, obj.index);
+	updatePositions(list, position_in_list, position, list.size());
+	return true;
+}
+
+bool Scene::eraseFromList(List& list, Position position_in_list, Object obj)
+{
+	Slot* slot = getSlot(obj);
+	if (!slot || slot->*position_in_list == npos) return false;
+	size_t position = slot->*position_in_list;
+	list.erase(list.begin() + position);
+	slot->*position_in_list = npos;
+	updatePositions(list, position_in_list, position, list.size());
+	return true;
 }
 
-std::deque<Scene::Object>::const_iterator Scene::getObjectsItrForDrawList(Object obj) const
+bool Scene::moveInList(List& list, Position position_in_list, Object obj, int count)
 {
-	if (!isMyObject(obj)) return m_draw_order.end();
-	return std::find(m_draw_order.begin(), m_draw_order.end(), obj);
+	Slot* slot = getSlot(obj);
+	if (!slot || slot->*position_in_list == npos) return false;
+	size_t from = slot->*position_in_list;
+	size_t to = std::clamp<ptrdiff_t>(ptrdiff_t(from) + count, 0, list.size() - 1);
+	//only the entries between the old and the new positions shift
+	if (from < to) std::rotate(list.begin() + from, list.begin() + from + 1, list.begin() + to + 1);
+	else std::rotate(list.begin() + to, list.begin() + from, list.begin() + from + 1);
+	updatePositions(list, position_in_list, std::min(from, to), std::max(from, to) + 1);
+	return true;
 }
 
-bool Scene::isMyObject(Object obj) const
+void Scene::updatePositions(List& list, Position position_in_list, size_t first, size_t last)
 {
-	return *obj.scene_identifier != nullptr && **obj.scene_identifier == m_identifier;
+	for (size_t i = first; i < last; i++) m_slots[list[i]].*position_in_list = i;
 }
 
 void Scene::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	for (int i = 0; i < m_draw_order.size(); i++)
-	{
-		if (isMyObject(m_draw_order[i])) target.draw(*m_draw_order[i].drawable_ptr, states);
-		else m_draw_order.erase(m_draw_order.begin() + i--);
-	}
+	PROFILE_SCOPE("Scene::draw");
+	for (uint32_t index : m_draw_order) target.draw(*m_slots[index].drawable_ptr, states);
 }
 
 SimpleView InstantScrolling::getView(sf::Time passed_time, const SimpleView & start_view, const SimpleView & end_view) const
@@ -1,12 +1,16 @@
 #pragma once
 #include <string>
-#include <unordered_set>
-#include <deque>
+#include <vector>
+#include <cstdint>
+#include <atomic>
 
 #include <SFML/Graphics.hpp>
 #include <Thor/Resources.hpp>
 #include <nlohmann/json.hpp>
 
+#include <common/Camera.hpp>
+#include <common/InplaceFunction.hpp>
+
 class SimpleView
 {
 	using Vector2f = sf::Vector2f;
@@ -65,73 +69,46 @@ public:
 	Scene(const Scene&) = default;
 	Scene(Scene&&) = default;
 
-	~Scene();
-
-	void setWindow(sf::RenderWindow* window);
-	sf::RenderWindow* getWindow() const;
+	void setCamera(Camera* camera);
+	Camera* getCamera() const;
 
+	//a handle to an object of the scene, the index of its slot and the generation of the slot
+	//the slot of a removed object is reused with the next generation, so the old handles to it are not valid anymore
 	class Object
 	{
+		size_t scene_identifier{};
+		uint32_t index{}, generation{};
 
-		Object(std::shared_ptr<const size_t*> scene_identifier);
-
-		std::shared_ptr<const size_t*> scene_identifier;
-		sf::Drawable* drawable_ptr{};
-		std::function<void(sf::Time)> update{};
-		size_t identifier{};
-		inline static size_t identifier_counter{};
-
-		struct Hasher
-		{
-			size_t operator()(const Object& obj) const;
-		};
+		Object(size_t scene_identifier, uint32_t index, uint32_t generation);
 
 	public:
 
-		Object(const Object& other);
-		Object get_duplicate() const;
-		template<class F>
-			requires std::invocable<F> || std::invocable<F, sf::Time>
-		void setUpdate(F update_function)
-		{
-			if constexpr (requires { update_function(sf::Time::Zero); })
-				update = [update_function](sf::Time t) {update_function(t); };
-			else if constexpr (requires { update_function(); })
-				update = [update_function](sf::Time) {update_function(); };
-			else update = [](sf::Time) {};
-		}
-		bool operator==(Object other) const;
+		Object() = default;
+		bool operator==(const Object& other) const = default;
 		friend class Scene;
 	};
 
-
 	template<std::derived_from<sf::Drawable> T>
 	Object addObject(T& obj)
 	{
-		Object object(std::make_shared<const size_t*>(&m_identifier));
-		object.drawable_ptr = &obj;
 		if constexpr (requires { obj.update(sf::Time::Zero); })
-			object.update = [&obj](sf::Time t) {obj.update(t); };
+			return addObject(obj, [&obj](sf::Time t) {obj.update(t); });
 		else if constexpr (requires { obj.update(); })
-			object.update = [&obj](sf::Time) {obj.update(); };
-		else object.update = [](sf::Time) {};
-
-		m_objects.insert(object);
-		addToUpdateList(object);
-		addToDrawList(object);
-
-		return object;
+			return addObject(obj, [&obj]() {obj.update(); });
+		else return addObject(obj, []() {});
 	}
 
+	//the same drawable can be added more than once (with other updates), every time it is a new object
 	template<std::derived_from<sf::Drawable> T, class F>
 		requires std::invocable<F> || std::invocable<F, sf::Time>
 	Object addObject(T& obj, F update)
 	{
-		Object object(std::make_shared<const size_t*>(&m_identifier));
-		object.drawable_ptr = &obj;
-		object.setUpdate(update);
+		UpdateFunctionType update_function;
+		if constexpr (requires { update(sf::Time::Zero); })
+			update_function = [update](sf::Time t) {update(t); };
+		else update_function = [update](sf::Time) {update(); };
 
-		m_objects.insert(object);
+		Object object = createObject(obj, std::move(update_function));
 		addToUpdateList(object);
 		addToDrawList(object);
 
@@ -174,29 +151,51 @@ public:
 	}
 
 	void updateObjects(sf::Time dt);
-	void updateScrolling();
+	//the scrolling advances by the simulated time (not the real one), so it is the same in every run
+	void updateScrolling(sf::Time dt = sf::Time::Zero);
 
 	SimpleView getCurrentView() const;
 
 private:
 
-	std::deque<Object>::iterator getObjectsItrForUpdateList(Object obj);
-	std::deque<Object>::iterator getObjectsItrForDrawList(Object obj);
-	std::deque<Object>::const_iterator getObjectsItrForUpdateList(Object obj) const;
-	std::deque<Object>::const_iterator getObjectsItrForDrawList(Object obj) const;
+	using UpdateFunctionType = InplaceFunction<void(sf::Time)>;
+	static constexpr size_t npos = -1;
+
+	//the update and draw lists are dense arrays of the indices of the slots, every slot keeps its positions in them
+	//so finding an object in a list is one lookup, and a frame walks the lists without checking the objects
+	struct Slot
+	{
+		sf::Drawable* drawable_ptr{};
+		UpdateFunctionType update{};
+		uint32_t generation{};
+		bool is_alive{ false };
+		size_t update_position{ npos }, draw_position{ npos };
+	};
+	using List = std::vector<uint32_t>;
+	using Position = size_t Slot::*;
+
+	Object createObject(sf::Drawable& drawable, UpdateFunctionType update);
+	//nullptr if the handle is not to a live object of this scene
+	Slot* getSlot(Object obj);
+	bool insertIntoList(List& list, Position position_in_list, Object obj, int position);
+	bool eraseFromList(List& list, Position position_in_list, Object obj);
+	bool moveInList(List& list, Position position_in_list, Object obj, int count);
+	//the slots of the entries from first to last (not included) have moved in the list
+	void updatePositions(List& list, Position position_in_list, size_t first, size_t last);
 
 	SimpleView m_view{}, m_view_destination{};
 	std::unique_ptr<ViewScrolling> m_scrolling_type_ptr{nullptr};
-	std::unordered_set<Object, Object::Hasher> m_objects{};
-	std::deque<Object> m_update_order;
-	mutable std::deque<Object> m_draw_order;
-	sf::Clock m_scroll_timer;
+	std::vector<Slot> m_slots{};
+	std::vector<uint32_t> m_free_slots{};
+	List m_update_order{};
+	List m_draw_order{};
+	sf::Time m_scroll_time{};
 	bool m_in_scroll{false};
-	sf::RenderWindow* m_window_ptr{nullptr};
+	Camera* m_camera_ptr{nullptr};
 
-	inline static size_t identifier_counter{ 0 };
+	//from 1, so the default handle is not to an object of any scene
+	inline static std::atomic<size_t> identifier_counter{ 1 };
 	const size_t m_identifier{ identifier_counter++ };
-	bool isMyObject(Object obj) const;
 
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
@@ -0,0 +1,137 @@
+#include "CollisionWorld.hpp"
+
+#include <algorithm>
+
+#include <common/Utils.hpp>
+#include <common/Profiler.hpp>
+#include <gameObjects/Doodle.hpp>
+#include <gameObjects/Tiles.hpp>
+#include <gameObjects/Items.hpp>
+#include <gameObjects/Monsters.hpp>
+
+void CollisionWorld::update(Doodle& doodle, Tiles& tiles, Items& items, Monsters& monsters)
+{
+	PROFILE_SCOPE("CollisionWorld::update");
+
+	//the boxes do not change until the next update of the objects, so the pairs stay valid while the callbacks run
+	registerBoxes(doodle, tiles, items, monsters);
+	m_pairs.clear();
+	for (size_t probe = 0; probe < m_probe_boxes.size(); probe++)
+	{
+		m_intersecting.clear();
+		m_body_boxes.findIntersecting(m_probe_boxes[probe], m_intersecting);
+		for (size_t body : m_intersecting) m_pairs.emplace_back(probe, body);
+	}
+
+	dispatchTileJumps(doodle, tiles);
+	dispatchItemCollisions(doodle, items);
+	dispatchBullets(doodle, monsters);
+	if (dispatchMonsterJumps(doodle, monsters)) return;
+	dispatchMonsterBumps(doodle, monsters);
+}
+
+size_t CollisionWorld::getPairsCount() const
+{
+	return m_pairs.size();
+}
+
+void CollisionWorld::registerBoxes(const Doodle& doodle, const Tiles& tiles, const Items& items, const Monsters& monsters)
+{
+	//only the bottom line of the feet lands, it is swept back along the displacement of the doodle
+	sf::FloatRect feet = doodle.getFeetCollisionBox();
+	sf::Vector2f displacement = doodle.getDisplacement();
+	sf::FloatRect feet_line{ feet.left, feet.top + feet.height - 1, feet.width, 1 };
+	sf::FloatRect swept_feet{ feet_line.left - std::max(displacement.x, 0.f), feet_line.top - std::max(displacement.y, 0.f), feet_line.width + std::abs(displacement.x), feet_line.height + std::abs(displacement.y) };
+
+	m_probe_boxes.clear();
+	m_probe_boxes.push_back(swept_feet);
+	m_probe_boxes.push_back(feet);
+	m_probe_boxes.push_back(doodle.getBodyCollisionBox());
+	for (size_t i = 0; i < doodle.m_bullets.size(); i++) m_probe_boxes.push_back(doodle.m_bullets.getGlobalBounds(i));
+
+	m_body_boxes.clear();
+	m_bodies.clear();
+	m_body_boxes.reserve(tiles.m_tiles.size() + items.m_items.size() + monsters.m_monsters.size());
+	for (size_t i = 0; i < tiles.m_tiles.size(); i++)
+	{
+		if (!tiles.m_tiles[i]->canCollide()) continue;
+		m_body_boxes.push_back(tiles.m_tiles[i]->getCollisionBox());
+		m_bodies.push_back({ BodyKind::Tile, i });
+	}
+	for (size_t i = 0; i < items.m_items.size(); i++)
+	{
+		m_body_boxes.push_back(items.m_items[i]->getCollisionBox());
+		m_bodies.push_back({ BodyKind::Item, i });
+	}
+	for (size_t i = 0; i < monsters.m_monsters.size(); i++)
+	{
+		m_body_boxes.push_back(monsters.m_monsters[i]->getCollisionBox());
+		m_bodies.push_back({ BodyKind::Monster, i });
+	}
+}
+
+void CollisionWorld::dispatchTileJumps(Doodle& doodle, Tiles& tiles)
+{
+	if (doodle.getVelocity().y < 0) return;
+
+	//the same landing as Tiles::getTileDoodleWillJump, with the tiles the broadphase paired with the swept feet
+	m_tile_candidates.clear();
+	for (size_t index : getPairedBodies(BodyKind::Tile, SweptFeet, SweptFeet)) m_tile_candidates.push_back(tiles.m_tiles[index].get());
+	if (auto landing = findLanding(doodle.getFeetCollisionBox(), doodle.getDisplacement(), m_tile_candidates, m_tile_hits, [](Tile* tile, sf::FloatRect) { return tile->m_on_doodle_jump(); }))
+	{
+		doodle.landAt(landing.time);
+		doodle.jump();
+	}
+}
+
+void CollisionWorld::dispatchItemCollisions(Doodle& doodle, Items& items)
+{
+	for (size_t index : getPairedBodies(BodyKind::Item, Feet, DoodleBody)) items.m_items[index]->m_on_doodle_collision(&doodle);
+}
+
+void CollisionWorld::dispatchBullets(Doodle& doodle, Monsters& monsters)
+{
+	//the pairs are sorted, so the monsters are shot in the order of the bullets and then of the monsters
+	m_shot_bullets.assign(doodle.m_bullets.size(), false);
+	for (auto [probe, body] : m_pairs)
+		if (probe >= FirstBullet && m_bodies[body].kind == BodyKind::Monster)
+			if (monsters.m_monsters[m_bodies[body].index]->getShooted(doodle.m_bullets.getGlobalBounds(probe - FirstBullet))) m_shot_bullets[probe - FirstBullet] = true;
+	//from the back, so the bullet swapped into the place of a removed one is one that was not hit
+	for (size_t i = doodle.m_bullets.size(); i-- > 0;) if (m_shot_bullets[i]) doodle.m_bullets.remove(i);
+}
+
+bool CollisionWorld::dispatchMonsterJumps(Doodle& doodle, Monsters& monsters)
+{
+	if (doodle.getVelocity().y < 0) return false;
+
+	m_monster_candidates.clear();
+	for (size_t index : getPairedBodies(BodyKind::Monster, SweptFeet, SweptFeet)) m_monster_candidates.push_back(monsters.m_monsters[index].get());
+	auto landing = findLanding(doodle.getFeetCollisionBox(), doodle.getDisplacement(), m_monster_candidates, m_monster_hits, [](Monster* monster, sf::FloatRect feet_at_hit) { return monster->m_on_doodle_jump(feet_at_hit); });
+	if (!landing) return false;
+
+	//jumping from a monster is higher
+	doodle.landAt(landing.time);
+	float jumping_speed = doodle.getJumpingSpeed();
+	doodle.setJumpingSpeed(jumping_speed + 150);
+	doodle.jump();
+	doodle.setJumpingSpeed(jumping_speed);
+	return true;
+}
+
+void CollisionWorld::dispatchMonsterBumps(Doodle& doodle, Monsters& monsters)
+{
+	if (doodle.hasItem() || doodle.hasShield()) return;
+	for (size_t index : getPairedBodies(BodyKind::Monster, Feet, DoodleBody)) monsters.m_monsters[index]->m_on_doodle_bump(&doodle);
+}
+
+const std::vector<size_t>& CollisionWorld::getPairedBodies(BodyKind kind, Probe first_probe, Probe last_probe)
+{
+	std::vector<size_t>& bodies = m_paired_bodies;
+	bodies.clear();
+	for (auto [probe, body] : m_pairs)
+		if (probe >= first_probe && probe <= last_probe && m_bodies[body].kind == kind) bodies.push_back(body);
+	std::sort(bodies.begin(), bodies.end());
+	bodies.erase(std::unique(bodies.begin(), bodies.end()), bodies.end());
+	for (size_t& body : bodies) body = m_bodies[body].index;
+	return bodies;
+}
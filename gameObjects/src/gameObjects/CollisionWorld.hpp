@@ -0,0 +1,75 @@
+#pragma once
+#include <vector>
+#include <utility>
+
+#include <SFML/Graphics.hpp>
+
+#include <common/BoxArray.hpp>
+#include <gameObjects/Landing.hpp>
+
+class Doodle;
+class Tile;
+class Tiles;
+class Items;
+class Monster;
+class Monsters;
+
+//the collisions of the doodle with the tiles, items and monsters
+//every tick the tiles, items and monsters register their boxes (in a BoxArray), the doodle its probes (the swept feet, the feet, the body and the bullets) and every probe is tested against all the boxes with the SIMD kernel
+//the pairs are dispatched to the callbacks in the order the separate passes used: the tile jumps, the item collisions, the shot monsters, the monster jumps and the monster bumps
+class CollisionWorld
+{
+public:
+	void update(Doodle& doodle, Tiles& tiles, Items& items, Monsters& monsters);
+
+	//how many pairs the last broadphase found
+	size_t getPairsCount() const;
+
+private:
+	enum class BodyKind
+	{
+		Tile,
+		Item,
+		Monster
+	};
+
+	struct Body
+	{
+		BodyKind kind;
+		size_t index; // in the container of its kind
+	};
+
+	//the first probes are fixed, the bullets follow
+	enum Probe : size_t
+	{
+		SweptFeet,
+		Feet,
+		DoodleBody,
+		FirstBullet
+	};
+
+	void registerBoxes(const Doodle& doodle, const Tiles& tiles, const Items& items, const Monsters& monsters);
+	void dispatchTileJumps(Doodle& doodle, Tiles& tiles);
+	void dispatchItemCollisions(Doodle& doodle, Items& items);
+	void dispatchBullets(Doodle& doodle, Monsters& monsters);
+	bool dispatchMonsterJumps(Doodle& doodle, Monsters& monsters);
+	void dispatchMonsterBumps(Doodle& doodle, Monsters& monsters);
+
+	//the bodies of the kind paired with one of the probes, in the order of their container (a body once even if it is paired with many)
+	//the list is valid until the next call
+	const std::vector<size_t>& getPairedBodies(BodyKind kind, Probe first_probe, Probe last_probe);
+
+	std::vector<sf::FloatRect> m_probe_boxes{};
+	BoxArray m_body_boxes{};
+	std::vector<Body> m_bodies{};
+	std::vector<std::pair<size_t, size_t>> m_pairs{}; // probe, body
+	std::vector<size_t> m_intersecting{};
+
+	//the buffers of the dispatches, kept between the ticks
+	std::vector<size_t> m_paired_bodies{};
+	std::vector<Tile*> m_tile_candidates{};
+	std::vector<std::pair<float, Tile*>> m_tile_hits{};
+	std::vector<Monster*> m_monster_candidates{};
+	std::vector<std::pair<float, Monster*>> m_monster_hits{};
+	std::vector<bool> m_shot_bullets{};
+};
@@ -1,4 +1,5 @@
 #include "Doodle.hpp"
+#include <algorithm>
 
 #include <Thor/Math.hpp>
 #include <Thor/Vectors.hpp>
@@ -10,11 +11,12 @@
 Doodle::Doodle(sf::Vector2f starting_pos)
 {
 	setPosition(starting_pos);
-	m_body_normal_exhind = m_body.addExhibit({ (sf::FloatRect)global_sprites["doodle_body_right"].texture_rect, {40, 40}});
-	m_body_shooting_exhind = m_body.addExhibit({ (sf::FloatRect)global_sprites["doodle_body_up"].texture_rect, {40, 40} });
-	m_feet_normal_exhind = m_feet.addExhibit({ (sf::FloatRect)global_sprites["doodle_feet_right"].texture_rect, {40, 10} });
-	m_feet_shooting_exhind = m_feet.addExhibit({ (sf::FloatRect)global_sprites["doodle_feet_up"].texture_rect, {40, 10} });
-	m_nose_exhind = m_nose.addExhibit({ (sf::FloatRect)global_sprites["doodle_nose"].texture_rect, { 20, 20 } });
+	m_previous_position = starting_pos;
+	m_body_normal_exhind = m_body.addExhibit({ (sf::FloatRect)global_sprites.at("doodle_body_right").texture_rect, {40, 40}});
+	m_body_shooting_exhind = m_body.addExhibit({ (sf::FloatRect)global_sprites.at("doodle_body_up").texture_rect, {40, 40} });
+	m_feet_normal_exhind = m_feet.addExhibit({ (sf::FloatRect)global_sprites.at("doodle_feet_right").texture_rect, {40, 10} });
+	m_feet_shooting_exhind = m_feet.addExhibit({ (sf::FloatRect)global_sprites.at("doodle_feet_up").texture_rect, {40, 10} });
+	m_nose_exhind = m_nose.addExhibit({ (sf::FloatRect)global_sprites.at("doodle_nose").texture_rect, { 20, 20 } });
 
 	m_body.set(m_body_normal_exhind);
 	m_feet.set(m_feet_normal_exhind);
@@ -24,14 +26,11 @@ Doodle::Doodle(sf::Vector2f starting_pos)
 
 	m_head_bump_star.setOrigin(12, 12);
 	m_head_bump_star.setScale(m_texture_scale);
-
-	m_bullet_sprite.setTextureRect(global_sprites["doodle_bullet"].texture_rect);
-	m_bullet_sprite.setScale(m_texture_scale);
-	m_bullet_sprite.setOrigin(11, 11);
 }
 
 void Doodle::update(sf::Time dt)
 {
+	m_previous_position = getPosition();
 	m_existing_time += dt;
 	m_speed_change_rate = 2 * m_moving_speed;
 	if (m_is_jumping) if (m_existing_time - m_jumping_start > m_jumping_interval) m_is_jumping = false;
@@ -43,12 +42,14 @@ void Doodle::update(sf::Time dt)
 
 	m_velocity += m_gravity * dt.asSeconds();
 	m_velocity.x /= std::pow(m_speed_decreasing_rate, dt.asSeconds());
-	move(m_velocity * dt.asSeconds());
+	m_displacement = m_velocity * dt.asSeconds();
+	move(m_displacement);
 
 	if (m_area != sf::FloatRect{})
 	{
-		if (getPosition().x > m_area.left + m_area.width) move(-m_area.width, 0);
-		if (getPosition().x < m_area.left) move(m_area.width, 0);
+		//the feet are not swept across the screen on the wrapping tick, only down where they are now
+		if (getPosition().x > m_area.left + m_area.width) { move(-m_area.width, 0); m_displacement.x = 0; }
+		if (getPosition().x < m_area.left) { move(m_area.width, 0); m_displacement.x = 0; }
 		m_is_fallen_out = (m_body.getGlobalBounds().top > m_area.top + m_area.height);
 		m_is_too_high = (getPosition().y < m_area.top);
 	}
@@ -67,11 +68,7 @@ void Doodle::update(sf::Time dt)
 		m_current_texture_scale = m_texture_scale * (1 - progress * progress);
 	}
 
-	for (size_t i = 0; i < m_bullets.size(); i++)
-	{
-		m_bullets[i].update(dt);
-		if (!sf::FloatRect(m_area.left, m_area.top - 3 * m_area.height, m_area.width, 4 * m_area.height).intersects(m_bullets[i].getGlobalBounds())) m_bullets.erase(m_bullets.begin() + i--);
-	}
+	m_bullets.update(dt, sf::FloatRect(m_area.left, m_area.top - 3 * m_area.height, m_area.width, 4 * m_area.height));
 
 	m_is_updating_for_drawing_needed = true;
 }
@@ -93,10 +90,7 @@ void Doodle::shoot(float angle)
 	m_nose_angle = std::clamp(angle, -m_max_nose_angle_dev, m_max_nose_angle_dev);
 	m_shooting_start = m_existing_time;
 
-	Bullet bullet(m_bullet_sprite);
-	bullet.setVelocity(thor::rotatedVector({ 0, -m_bullet_speed }, m_nose_angle));
-	bullet.setPosition(m_nose.getPosition());
-	m_bullets.push_back(bullet);
+	m_bullets.add(m_nose.getPosition(), thor::rotatedVector({ 0, -m_bullet_speed }, m_nose_angle));
 }
 
 void Doodle::updateArea(sf::FloatRect area)
@@ -104,32 +98,6 @@ void Doodle::updateArea(sf::FloatRect area)
 	m_area = sf::FloatRect{ area.left, area.top + area.height / 2, area.width, area.height / 2};
 }
 
-void Doodle::updateTiles(Tiles& tiles)
-{
-	if (m_velocity.y < 0) return;
-	if (tiles.willDoodleJump(m_feet_collision_box)) jump();
-}
-
-void Doodle::updateItems(Items& items)
-{
-	items.updateDoodleCollisions(this);
-}
-
-void Doodle::updateMonsters(Monsters& monsters)
-{
-	for (size_t i = 0; i < m_bullets.size(); i++) if (monsters.updateBullet(m_bullets[i])) m_bullets.erase(m_bullets.begin() + i--);
-
-	if (m_velocity.y >= 0 && monsters.willDoodleJump(m_feet_collision_box))
-	{
-		float jumping_speed = getJumpingSpeed();
-		setJumpingSpeed(jumping_speed + 150);
-		jump();
-		setJumpingSpeed(jumping_speed);
-		return;
-	}
-	if(!hasItem() && !hasShield()) monsters.updateDoodleBump(this);
-}
-
 sf::FloatRect Doodle::getArea() const
 {
 	return m_area;
@@ -160,6 +128,7 @@ void Doodle::ressurrect(sf::Vector2f position)
 	m_is_shrinking = false;
 	m_current_texture_scale = m_texture_scale;
 	setVelocity({ 0, 0 });
+	m_displacement = { 0, 0 };
 	setPosition(position);
 	setRotation(0);
 }
@@ -229,6 +198,11 @@ sf::Vector2f Doodle::getVelocity() const
 	return m_velocity;
 }
 
+sf::Vector2f Doodle::getDisplacement() const
+{
+	return m_displacement;
+}
+
 sf::Vector2f Doodle::getGravity() const
 {
 	return m_gravity;
@@ -258,6 +232,15 @@ void Doodle::jump()
 	m_jumping_start = m_existing_time;
 }
 
+void Doodle::landAt(float time)
+{
+	float back = m_displacement.y * (1 - time);
+	move(0, -back);
+	m_displacement.y -= back;
+	m_feet_collision_box.top -= back;
+	m_body_collision_box.top -= back;
+}
+
 void Doodle::setVelocity(sf::Vector2f velocity)
 {
 	m_velocity = velocity;
@@ -303,6 +286,12 @@ void Doodle::setShield(Shield* shield)
 	m_shield = shield;
 }
 
+void Doodle::setInterpolationAlpha(float alpha)
+{
+	m_interpolation_alpha = alpha;
+	m_bullets.setInterpolationAlpha(alpha);
+}
+
 void Doodle::updateForDrawing() const
 {
 	if(m_is_updating_for_drawing_needed)
@@ -355,7 +344,11 @@ void Doodle::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
 	updateForDrawing();
 	
-	for (auto& bullet : m_bullets) target.draw(bullet, states);
+	target.draw(m_bullets, states);
+
+	//no interpolation when the doodle was wrapped to the other side of the area
+	sf::Vector2f offset = utils::getInterpolationOffset(m_previous_position, getPosition(), m_interpolation_alpha);
+	if (std::abs(m_previous_position.x - getPosition().x) < m_area.width / 2) states.transform.translate(offset);
 
 	if(m_draw_feet) target.draw(m_feet, states);
 	target.draw(m_body, states);
@@ -383,37 +376,85 @@ void Doodle::draw(sf::RenderTarget& target, sf::RenderStates states) const
 	target.draw(sh_body, states);*/
 }
 
-Bullet::Bullet(const sf::Sprite& sprite):
-	Sprite(sprite)
+BulletPool::BulletPool(const sf::Texture& texture, sf::IntRect texture_rect, sf::Vector2f origin, sf::Vector2f scale):
+	m_texture(&texture),
+	m_texture_rect(texture_rect),
+	m_local_bounds(-utils::element_wiseProduct(origin, scale), utils::element_wiseProduct(sf::Vector2f(texture_rect.width, texture_rect.height), scale))
 {}
 
-void Bullet::setVelocity(sf::Vector2f velocity)
+void BulletPool::add(sf::Vector2f position, sf::Vector2f velocity)
 {
-	m_velocity = velocity;
+	Bullet bullet{ position, position, velocity, {}, m_shots++ };
+	if (m_size < capacity)
+	{
+		m_bullets[m_size++] = bullet;
+		return;
+	}
+	*std::ranges::min_element(m_bullets, {}, &Bullet::shot) = bullet;
 }
 
-void Bullet::setGravity(sf::Vector2f gravity)
+void BulletPool::remove(size_t index)
 {
-	m_gravity = gravity;
+	m_bullets[index] = m_bullets[--m_size];
 }
 
-sf::Vector2f Bullet::getVelocity() const
+void BulletPool::clear()
 {
-	return m_velocity;
+	m_size = 0;
 }
 
-sf::Vector2f Bullet::getGravity() const
+size_t BulletPool::size() const
 {
-	return m_gravity;
+	return m_size;
 }
 
-void Bullet::update(sf::Time dt)
+const Bullet& BulletPool::operator[](size_t index) const
 {
-	m_velocity += m_gravity * dt.asSeconds();
-	move(m_velocity * dt.asSeconds());
+	return m_bullets[index];
+}
+
+sf::FloatRect BulletPool::getGlobalBounds(size_t index) const
+{
+	return sf::FloatRect(m_bullets[index].position + sf::Vector2f(m_local_bounds.left, m_local_bounds.top), { m_local_bounds.width, m_local_bounds.height });
+}
+
+void BulletPool::update(sf::Time dt, sf::FloatRect area)
+{
+	for (size_t i = 0; i < m_size; i++)
+	{
+		Bullet& bullet = m_bullets[i];
+		bullet.previous_position = bullet.position;
+		bullet.velocity += bullet.gravity * dt.asSeconds();
+		bullet.position += bullet.velocity * dt.asSeconds();
+	}
+	//the last bullet is moved to the place of the removed one, so the place is checked again
+	for (size_t i = 0; i < m_size; i++)
+		if (!area.intersects(getGlobalBounds(i))) remove(i--);
+}
+
+void BulletPool::setInterpolationAlpha(float alpha)
+{
+	m_interpolation_alpha = alpha;
 }
 
-void Bullet::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void BulletPool::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	target.draw(sf::Sprite(*this), states);
+	if (!m_size) return;
+	sf::Vector2f tex_min{ m_texture_rect.left, m_texture_rect.top }, tex_max{ m_texture_rect.left + m_texture_rect.width, m_texture_rect.top + m_texture_rect.height };
+	for (size_t i = 0; i < m_size; i++)
+	{
+		sf::FloatRect bounds = getGlobalBounds(i);
+		sf::Vector2f offset = utils::getInterpolationOffset(m_bullets[i].previous_position, m_bullets[i].position, m_interpolation_alpha);
+		sf::Vector2f min{ bounds.left + offset.x, bounds.top + offset.y }, max{ min.x + bounds.width, min.y + bounds.height };
+		//two triangles for every bullet
+		sf::Vertex* quad = &m_vertices[i * 6];
+		quad[0] = sf::Vertex(min, tex_min);
+		quad[1] = sf::Vertex({ max.x, min.y }, { tex_max.x, tex_min.y });
+		quad[2] = sf::Vertex(max, tex_max);
+		quad[3] = quad[0];
+		quad[4] = quad[2];
+		quad[5] = sf::Vertex({ min.x, max.y }, { tex_min.x, tex_max.y });
+	}
+	states.texture = m_texture;
+	target.draw(m_vertices.data(), m_size * 6, sf::Triangles, states);
 }
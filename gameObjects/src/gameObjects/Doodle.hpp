@@ -2,7 +2,7 @@
 #include <string>
 #include <map>
 #include <functional>
-#include <deque>
+#include <array>
 
 #include <SFML/Graphics.hpp>
 #include <Selbaward.hpp>
@@ -12,21 +12,47 @@
 #include <gameObjects/Items.hpp>
 
 
-class Bullet : public sf::Sprite
+//a bullet is only its motion, its sprite is shared by all the bullets of the BulletPool
+struct Bullet
+{
+	sf::Vector2f position{}, previous_position{}, velocity{}, gravity{};
+	//the number of the shot, the bullet with the lowest one is the oldest
+	size_t shot{ 0 };
+};
+
+//the bullets of the doodle in a fixed array, so shooting never allocates
+//a new bullet is put after the last one and a removed one is replaced by the last one (the order of the bullets is not kept)
+//all the bullets are drawn with one draw call from one vertex array
+class BulletPool : public sf::Drawable
 {
-	sf::Vector2f m_velocity, m_gravity;
 public:
-	Bullet(const sf::Sprite& sprite);
-	void setVelocity(sf::Vector2f velocity);
-	void setGravity(sf::Vector2f gravity);
-	sf::Vector2f getVelocity() const;
-	sf::Vector2f getGravity() const;
+	//a shot can come every tick, so a full pool is reachable, the new bullet then replaces the oldest one
+	static constexpr size_t capacity{ 128 };
 
-	void update(sf::Time dt);
+	BulletPool(const sf::Texture& texture, sf::IntRect texture_rect, sf::Vector2f origin, sf::Vector2f scale);
+
+	void add(sf::Vector2f position, sf::Vector2f velocity);
+	void remove(size_t index);
+	void clear();
+	size_t size() const;
+	const Bullet& operator[](size_t index) const;
+	sf::FloatRect getGlobalBounds(size_t index) const;
+
+	//the bullets that left the area are removed
+	void update(sf::Time dt, sf::FloatRect area);
+	void setInterpolationAlpha(float alpha);
 
 private:
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
+	std::array<Bullet, capacity> m_bullets{};
+	size_t m_size{ 0 }, m_shots{ 0 };
+	const sf::Texture* m_texture;
+	sf::FloatRect m_texture_rect;
+	//the bounds of the bullet relative to its position
+	sf::FloatRect m_local_bounds;
+	float m_interpolation_alpha{ 1 };
+	mutable std::array<sf::Vertex, capacity * 6> m_vertices{};
 };
 
 class Tiles;
@@ -43,9 +69,6 @@ public:
 	void right(sf::Time dt);
 	void shoot(float angle);
 	void updateArea(sf::FloatRect area);
-	void updateTiles(Tiles& tiles);
-	void updateItems(Items& items);
-	void updateMonsters(Monsters& monsters);
 
 	void dieHeadBump();
 	void dieShrink(sf::Vector2f shrinking_pos, sf::Time duration = sf::seconds(0.5), float rotation_speed = 0);
@@ -67,15 +90,20 @@ public:
 
 	sf::FloatRect getArea() const;
 	sf::Vector2f getVelocity() const;
+	//how much the velocity moved the doodle in the last update
+	sf::Vector2f getDisplacement() const;
 	sf::Vector2f getGravity() const;
 	float getJumpingSpeed() const;
 	sf::FloatRect getFeetCollisionBox() const;
 	sf::FloatRect getBodyCollisionBox() const;
 	void updateForDrawing() const;
+	void setInterpolationAlpha(float alpha);
 
 private:
 
 	void jump();
+	//moves the doodle back up along its last displacement to where its feet hit something at the time (from 0 to 1), so it does not jump from below what it fell through
+	void landAt(float time);
 	void setVelocity(sf::Vector2f velocity);
 	void setGravity(sf::Vector2f gravity);
 	void setJumpingSpeed(float speed);
@@ -96,13 +124,16 @@ private:
 
 
 	sf::Vector2f m_velocity{0, 0};
+	sf::Vector2f m_displacement{0, 0};
 	sf::Vector2f m_gravity{0, 1200};
+	sf::Vector2f m_previous_position{};
+	float m_interpolation_alpha{ 1 };
 	sf::Time m_existing_time{};
-	mutable sw::GallerySprite m_body{ global_textures["doodle"] };
+	mutable sw::GallerySprite m_body{ global_sprites.at("doodle_body_right").getTexture() };
 	size_t m_body_normal_exhind, m_body_shooting_exhind;
-	mutable sw::GallerySprite m_feet{ global_textures["doodle"] };
+	mutable sw::GallerySprite m_feet{ global_sprites.at("doodle_body_right").getTexture() };
 	size_t m_feet_normal_exhind, m_feet_shooting_exhind;
-	mutable sw::GallerySprite m_nose{ global_textures["doodle"] };
+	mutable sw::GallerySprite m_nose{ global_sprites.at("doodle_body_right").getTexture() };
 	size_t m_nose_exhind;
 	BodyStatus m_body_status{ Right };
 	sf::Vector2f m_body_collision_box_size{ 60, 70 };
@@ -138,7 +169,7 @@ private:
 	sf::Vector2f m_head_bump_stars_offset{0, -30};
 	sf::Vector2f m_head_bump_stars_rotating_boundaries{ 48, 25 };
 	sf::Time m_head_bump_stars_rotation_time{ sf::seconds(0.5) };
-	mutable sf::Sprite m_head_bump_star{ global_sprites["doodle_star"].getTexture(), global_sprites["doodle_star"].texture_rect };
+	mutable sf::Sprite m_head_bump_star{ global_sprites.at("doodle_star").getTexture(), global_sprites.at("doodle_star").texture_rect };
 	void animateHeadBumpStars(size_t index) const;
 
 	bool m_is_shrinking{ false };
@@ -148,8 +179,7 @@ private:
 
 	void die();
 
-	std::deque<Bullet> m_bullets;
-	sf::Sprite m_bullet_sprite{ global_sprites["doodle_bullet"].getTexture() };
+	BulletPool m_bullets{ global_sprites.at("doodle_bullet").getTexture(), global_sprites.at("doodle_bullet").texture_rect, { 11, 11 }, m_texture_scale };
 	float m_bullet_speed = 2000;
 
 	Shield* m_shield{ nullptr };
@@ -158,5 +188,6 @@ private:
 
 	//friend class DoodleWithStats;
 	friend class Item::DoodleManipulator;
+	friend class CollisionWorld;
 };
 
@@ -7,6 +7,7 @@
 #include <gameObjects/Monsters.hpp>
 #include <common/Resources.hpp>
 #include <common/Utils.hpp>
+#include <common/Profiler.hpp>
 
 Item::DoodleManipulator::DoodleManipulator(Doodle* doodle)
 {
@@ -55,6 +56,17 @@ sf::Vector2f Item::DoodleManipulator::getVelocity() const
 	return m_doodle->getVelocity();
 }
 
+sf::Vector2f Item::DoodleManipulator::getDisplacement() const
+{
+	if (!m_doodle) return {};
+	return m_doodle->getDisplacement();
+}
+
+void Item::DoodleManipulator::landAt(float time)
+{
+	if (m_doodle) m_doodle->landAt(time);
+}
+
 void Item::DoodleManipulator::setVelocity(sf::Vector2f velocity)
 {
 	if (!m_doodle) return;
@@ -155,12 +167,19 @@ Item::Item() : Item(nullptr)
 {}
 
 Item::Item(sf::Texture * texture_ptr):
-	m_animations(new thor::AnimationMap<sf::Sprite, std::string>()),
+	m_animations(getSharedAnimations([](SpriteAnimationMap&) {})),
 	m_animator(*m_animations)
 {
 	if (texture_ptr) setTexture(*texture_ptr);
 }
 
+void Item::setAnimations(std::shared_ptr<const SpriteAnimationMap> animations)
+{
+	//the animator points to the map it plays from
+	m_animations = std::move(animations);
+	m_animator = thor::Animator<sf::Sprite, std::string>(*m_animations);
+}
+
 sf::FloatRect Item::getCollisionBox() const
 {
 	return m_collision_box;
@@ -199,11 +218,17 @@ void Item::updatePhysics(sf::Time dt)
 
 void Item::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	target.draw(sf::Sprite(*this), states);
+	SpriteBatch batch(target, states);
+	addToBatch(batch, {});
+}
+
+void Item::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
+{
+	batch.add(*this, offset);
 }
 
 Spring::Spring(Tile* tile) :
-	Item(&global_sprites["items_spring_0"].getTexture())
+	Item(&global_sprites.at("items_spring_0").getTexture())
 {
 	m_tile = tile;
 	m_tile_offset.y = -14;
@@ -220,12 +245,15 @@ Spring::Spring(Tile* tile) :
 	});
 	tile->setReadyToBeDeleted(false);
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["items_spring_0"].texture_rect, { 17, 12 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation expand_animation;
-	expand_animation.addFrame(1, global_sprites["items_spring_1"].texture_rect, { 17, 42 });
-	m_animations->addAnimation("expand", expand_animation, sf::seconds(1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("items_spring_0").texture_rect, { 17, 12 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation expand_animation;
+		expand_animation.addFrame(1, global_sprites.at("items_spring_1").texture_rect, { 17, 42 });
+		animations.addAnimation("expand", expand_animation, sf::seconds(1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -254,7 +282,7 @@ float Trampoline::getDoodleRotation(float progress)
 }
 
 Trampoline::Trampoline(Tile* tile) :
-	Item(&global_sprites["items_trampoline_0"].getTexture())
+	Item(&global_sprites.at("items_trampoline_0").getTexture())
 {
 	m_tile = tile;
 	m_tile_offset.y = -16;
@@ -274,14 +302,17 @@ Trampoline::Trampoline(Tile* tile) :
 	});
 	tile->setReadyToBeDeleted(false);
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["items_trampoline_0"].texture_rect, { 36, 14 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation bounce_animation;
-	bounce_animation.addFrame(1, global_sprites["items_trampoline_0"].texture_rect, { 36, 14 });
-	bounce_animation.addFrame(1, global_sprites["items_trampoline_1"].texture_rect, { 36, 20 });
-	bounce_animation.addFrame(1, global_sprites["items_trampoline_2"].texture_rect, { 36, 14 });
-	m_animations->addAnimation("bounce", bounce_animation, sf::seconds(0.1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("items_trampoline_0").texture_rect, { 36, 14 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation bounce_animation;
+		bounce_animation.addFrame(1, global_sprites.at("items_trampoline_0").texture_rect, { 36, 14 });
+		bounce_animation.addFrame(1, global_sprites.at("items_trampoline_1").texture_rect, { 36, 20 });
+		bounce_animation.addFrame(1, global_sprites.at("items_trampoline_2").texture_rect, { 36, 14 });
+		animations.addAnimation("bounce", bounce_animation, sf::seconds(0.1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -326,7 +357,7 @@ float PropellerHat::getDoodleSpeed(float progress)
 }
 
 PropellerHat::PropellerHat(Tile* tile):
-	Item(&global_sprites["items_propeller_hat_0"].getTexture())
+	Item(&global_sprites.at("items_propeller_hat_0").getTexture())
 {
 	m_tile = tile;
 	m_tile_offset.y = -20;
@@ -349,15 +380,18 @@ PropellerHat::PropellerHat(Tile* tile):
 	});
 	m_tile->setReadyToBeDeleted(false);
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["items_propeller_hat_0"].texture_rect, { 29, 19 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation rotate_animation;
-	rotate_animation.addFrame(1, global_sprites["items_propeller_hat_1"].texture_rect, { 29, 27 });
-	rotate_animation.addFrame(1, global_sprites["items_propeller_hat_2"].texture_rect, { 29, 33 });
-	rotate_animation.addFrame(1, global_sprites["items_propeller_hat_1"].texture_rect, { 29, 27 });
-	rotate_animation.addFrame(1, global_sprites["items_propeller_hat_3"].texture_rect, { 29, 33 });
-	m_animations->addAnimation("rotate", rotate_animation, sf::seconds(0.5));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("items_propeller_hat_0").texture_rect, { 29, 19 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation rotate_animation;
+		rotate_animation.addFrame(1, global_sprites.at("items_propeller_hat_1").texture_rect, { 29, 27 });
+		rotate_animation.addFrame(1, global_sprites.at("items_propeller_hat_2").texture_rect, { 29, 33 });
+		rotate_animation.addFrame(1, global_sprites.at("items_propeller_hat_1").texture_rect, { 29, 27 });
+		rotate_animation.addFrame(1, global_sprites.at("items_propeller_hat_3").texture_rect, { 29, 33 });
+		animations.addAnimation("rotate", rotate_animation, sf::seconds(0.5));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -426,15 +460,15 @@ float Jetpack::getDoodleSpeed(float progress)
 	return -m_max_speed;
 }
 
-void Jetpack::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void Jetpack::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
 {
-	if(m_doodle_manip.hasDoodle()) target.draw(m_body, states);
-	target.draw(sf::Sprite(*this), states);
+	if(m_doodle_manip.hasDoodle()) batch.add(m_body, offset);
+	batch.add(*this, offset);
 }
 
 Jetpack::Jetpack(Tile* tile) :
-	Item(&global_sprites["items_jetpack_0"].getTexture()),
-	m_body(global_sprites["items_jetpack_0"].getTexture())
+	Item(&global_sprites.at("items_jetpack_0").getTexture()),
+	m_body(global_sprites.at("items_jetpack_0").getTexture())
 {
 	m_tile = tile;
 	m_tile_offset.y = -30;
@@ -458,29 +492,32 @@ Jetpack::Jetpack(Tile* tile) :
 	m_tile->setReadyToBeDeleted(false);
 	setScale(m_texture_scale, m_texture_scale);
 	m_body.setScale(getScale());
-	m_body.setTextureRect(global_sprites["items_jetpack_0"].texture_rect);
+	m_body.setTextureRect(global_sprites.at("items_jetpack_0").texture_rect);
 	m_body.setOrigin({12, 36});
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["items_jetpack_1"].texture_rect, { 24, 36 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation start_animation;
-	start_animation.addFrame(1, global_sprites["items_jetpack_2"].texture_rect, { 10, 0 });
-	start_animation.addFrame(1, global_sprites["items_jetpack_3"].texture_rect, { 14, 0 });
-	start_animation.addFrame(1, global_sprites["items_jetpack_4"].texture_rect, { 16, 0 });
-	start_animation.addFrame(1, global_sprites["items_jetpack_5"].texture_rect, { 24, 0 });
-	m_animations->addAnimation("start", start_animation, m_use_duration / 10.f);
-	thor::FrameAnimation fly_animation;
-	fly_animation.addFrame(1, global_sprites["items_jetpack_6"].texture_rect, { 26, 0 });
-	fly_animation.addFrame(1, global_sprites["items_jetpack_7"].texture_rect, { 28, 0 });
-	m_animations->addAnimation("fly", fly_animation, m_use_duration / 12.5f);
-	thor::FrameAnimation end_animation;
-	end_animation.addFrame(1, global_sprites["items_jetpack_8"].texture_rect, { 14, 0 });
-	end_animation.addFrame(1, global_sprites["items_jetpack_9"].texture_rect, { 13, 0 });
-	end_animation.addFrame(1, global_sprites["items_jetpack_10"].texture_rect, { 12, 0 });
-	m_animations->addAnimation("end", end_animation, m_use_duration / 10.f);
-	thor::FrameAnimation ended_animation;
-	ended_animation.addFrame(1, global_sprites["items_jetpack_0"].texture_rect, { 12, 36 });
-	m_animations->addAnimation("ended", ended_animation, sf::seconds(1));
+	setAnimations(getSharedAnimations([use_duration = m_use_duration](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("items_jetpack_1").texture_rect, { 24, 36 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation start_animation;
+		start_animation.addFrame(1, global_sprites.at("items_jetpack_2").texture_rect, { 10, 0 });
+		start_animation.addFrame(1, global_sprites.at("items_jetpack_3").texture_rect, { 14, 0 });
+		start_animation.addFrame(1, global_sprites.at("items_jetpack_4").texture_rect, { 16, 0 });
+		start_animation.addFrame(1, global_sprites.at("items_jetpack_5").texture_rect, { 24, 0 });
+		animations.addAnimation("start", start_animation, use_duration / 10.f);
+		thor::FrameAnimation fly_animation;
+		fly_animation.addFrame(1, global_sprites.at("items_jetpack_6").texture_rect, { 26, 0 });
+		fly_animation.addFrame(1, global_sprites.at("items_jetpack_7").texture_rect, { 28, 0 });
+		animations.addAnimation("fly", fly_animation, use_duration / 12.5f);
+		thor::FrameAnimation end_animation;
+		end_animation.addFrame(1, global_sprites.at("items_jetpack_8").texture_rect, { 14, 0 });
+		end_animation.addFrame(1, global_sprites.at("items_jetpack_9").texture_rect, { 13, 0 });
+		end_animation.addFrame(1, global_sprites.at("items_jetpack_10").texture_rect, { 12, 0 });
+		animations.addAnimation("end", end_animation, use_duration / 10.f);
+		thor::FrameAnimation ended_animation;
+		ended_animation.addFrame(1, global_sprites.at("items_jetpack_0").texture_rect, { 12, 36 });
+		animations.addAnimation("ended", ended_animation, sf::seconds(1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -556,15 +593,15 @@ float SpringShoes::getCurrentCompression()
 	return std::clamp(getCurrentCompressionWithoutClamp(), 0.f, 1.f);
 }
 
-void SpringShoes::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void SpringShoes::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
 {
-	target.draw(m_shoes, states);
-	target.draw(sf::Sprite(*this), states);
+	batch.draw(m_shoes, offset);
+	batch.add(*this, offset);
 }
 
 SpringShoes::SpringShoes(Tile* tile, size_t max_use_count, Tiles* tiles, Monsters* monsters):
-	Item(&global_sprites["items_spring_shoes_0"].getTexture()),
-	m_shoes(global_sprites["items_spring_shoes_0"].getTexture()),
+	Item(&global_sprites.at("items_spring_shoes_0").getTexture()),
+	m_shoes(global_sprites.at("items_spring_shoes_0").getTexture()),
 	m_max_use_count(max_use_count),
 	m_tiles(tiles),
 	m_monsters(monsters)
@@ -572,7 +609,7 @@ SpringShoes::SpringShoes(Tile* tile, size_t max_use_count, Tiles* tiles, Monster
 	m_tile = tile;
 	m_tile_offset.y = -24;
 	m_collision_box_size = sf::Vector2f{ 52, 38 } *m_texture_scale;
-	setTextureRect(global_sprites["items_spring_shoes_0"].texture_rect);
+	setTextureRect(global_sprites.at("items_spring_shoes_0").texture_rect);
 	setOrigin(26, 0);
 	setDoodleCollisionCallback([this](Doodle* doodle)
 	{
@@ -594,8 +631,8 @@ SpringShoes::SpringShoes(Tile* tile, size_t max_use_count, Tiles* tiles, Monster
 	m_tile->setReadyToBeDeleted(false);
 	setScale(m_texture_scale, m_texture_scale);
 	m_shoes.setScale(getScale());
-	m_shoes.addExhibit({ (sf::FloatRect)global_sprites["items_spring_shoes_1"].texture_rect, {26, 14} });
-	m_shoes.addExhibit({ (sf::FloatRect)global_sprites["items_spring_shoes_2"].texture_rect, {24, 14} });
+	m_shoes.addExhibit({ (sf::FloatRect)global_sprites.at("items_spring_shoes_1").texture_rect, {26, 14} });
+	m_shoes.addExhibit({ (sf::FloatRect)global_sprites.at("items_spring_shoes_2").texture_rect, {24, 14} });
 	m_shoes.set(1);
 }
 
@@ -646,8 +683,18 @@ void SpringShoes::update(sf::Time dt)
 				else if (compr > 0 && m_jumping) m_jumping = false;
 				if (compr > 1) m_current_platform = (Tile*)nullptr;
 			}
-			else if (Tile* jump_tile; m_doodle_manip.getVelocity().y > 0 && (jump_tile = m_tiles->getTileDoodleWillJump(getCollisionBox()))) m_current_platform = jump_tile;
-			else if (Monster* jump_monster; m_doodle_manip.getVelocity().y > 0 && (jump_monster = m_monsters->getMonsterDoodleWillJump(getCollisionBox()))) m_current_platform = jump_monster;
+			else if (Landing<Tile> landing; m_doodle_manip.getVelocity().y > 0 && (landing = m_tiles->getTileDoodleWillJump(getCollisionBox(), m_doodle_manip.getDisplacement())))
+			{
+				m_doodle_manip.landAt(landing.time);
+				setPosition(m_doodle_manip.getPosition() + m_doodle_offset);
+				m_current_platform = landing.object;
+			}
+			else if (Landing<Monster> landing; m_doodle_manip.getVelocity().y > 0 && (landing = m_monsters->getMonsterDoodleWillJump(getCollisionBox(), m_doodle_manip.getDisplacement())))
+			{
+				m_doodle_manip.landAt(landing.time);
+				setPosition(m_doodle_manip.getPosition() + m_doodle_offset);
+				m_current_platform = landing.object;
+			}
 		}
 	}
 	else
@@ -674,8 +721,9 @@ SpringShoes::~SpringShoes()
 	}
 }
 
-Shield::Shield(Tile* tile):
-	Item(&global_textures["items"])
+Shield::Shield(Tile* tile, RandomEngine random):
+	Item(&global_sprites.at("items_shield_0").getTexture()),
+	m_random(random)
 {
 	m_tile = tile;
 	m_tile_offset.y = -40;
@@ -696,14 +744,17 @@ Shield::Shield(Tile* tile):
 		});
 	tile->setReadyToBeDeleted(false);
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["items_shield_0"].texture_rect, { 33, 33 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation use_animation;
-	use_animation.addFrame(1, global_sprites["items_shield_1"].texture_rect, { 96, 96 });
-	use_animation.addFrame(1, global_sprites["items_shield_2"].texture_rect, { 96, 96 });
-	use_animation.addFrame(1, global_sprites["items_shield_3"].texture_rect, { 96, 96 });
-	m_animations->addAnimation("use", use_animation, sf::seconds(0.2));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("items_shield_0").texture_rect, { 33, 33 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation use_animation;
+		use_animation.addFrame(1, global_sprites.at("items_shield_1").texture_rect, { 96, 96 });
+		use_animation.addFrame(1, global_sprites.at("items_shield_2").texture_rect, { 96, 96 });
+		use_animation.addFrame(1, global_sprites.at("items_shield_3").texture_rect, { 96, 96 });
+		animations.addAnimation("use", use_animation, sf::seconds(0.2));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -732,7 +783,7 @@ void Shield::update(sf::Time dt)
 			if (m_existing_time - m_use_start >= m_end_start)
 			{
 				sf::Color col = getColor();
-				col.a = thor::Distributions::uniform(0, 1)() * 255;
+				col.a = m_random.uniform(0, 1) * 255;
 				setColor(col);
 			}
 			setPosition(m_doodle_manip.getPosition());
@@ -758,27 +809,49 @@ Shield::~Shield()
 	m_doodle_manip.setDoodle(nullptr);
 }
 
-Items::Items(sf::RenderWindow& game_window):
-	m_game_window(game_window)
+Items::Items(const Camera& camera):
+	m_camera(camera)
+{
+}
+
+void Items::add(Item* item)
 {
+	m_items.emplace_back(item);
+	item->m_previous_position = item->getPosition();
+}
+
+void Items::clear()
+{
+	m_items.clear();
 }
 
 void Items::update(sf::Time dt)
 {
-	for (auto& item : m_items) item->update(dt);
+	PROFILE_SCOPE("Items::update");
+	sf::FloatRect area = m_camera.getSnapshot().view_area;
+	m_is_removed.assign(m_items.size(), false);
+	for (size_t i = 0; i < m_items.size(); i++)
+	{
+		Item& item = *m_items[i];
+		item.m_previous_position = item.getPosition();
+		item.update(dt);
+		m_is_removed[i] = (item.isDestroyed() || item.getCollisionBox().top > area.top + area.height) && item.isReadyToBeDeleted();
+	}
 
+	//the kept items move down over the removed ones in the order of the flags, the removed ones are destroyed on the way
+	size_t kept = 0;
 	for (size_t i = 0; i < m_items.size(); i++)
-		if (sf::FloatRect area = utils::getViewArea(m_game_window); m_items[i]->isDestroyed() || m_items[i]->getCollisionBox().top > area.top + area.height)
-			if(m_items[i]->isReadyToBeDeleted())
-				m_items.erase(m_items.begin() + i--);
+	{
+		if (m_is_removed[i]) continue;
+		if (kept != i) m_items[kept] = std::move(m_items[i]);
+		kept++;
+	}
+	m_items.resize(kept);
 }
 
-void Items::updateDoodleCollisions(Doodle* doodle)
+void Items::setInterpolationAlpha(float alpha)
 {
-	for (auto& item : m_items)
-		if (item->getCollisionBox().intersects(doodle->getFeetCollisionBox())
-		 || item->getCollisionBox().intersects(doodle->getBodyCollisionBox()))
-			item->m_on_doodle_collision(doodle);
+	m_interpolation_alpha = alpha;
 }
 
 size_t Items::getItemsCount()
@@ -788,9 +861,10 @@ size_t Items::getItemsCount()
 
 void Items::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+	SpriteBatch batch(target, states);
 	for (const auto& item : m_items)
 	{
-		target.draw(*item, states);/*
+		item->addToBatch(batch, utils::getInterpolationOffset(item->m_previous_position, item->getPosition(), m_interpolation_alpha));/*
 		sf::RectangleShape sh{ {item->getCollisionBox().width, item->getCollisionBox().height} };
 		sh.setPosition(item->getCollisionBox().left, item->getCollisionBox().top);
 		sh.setFillColor(sf::Color(255, 0, 0, 100));
@@ -8,6 +8,13 @@
 #include <Thor/Math.hpp>
 #include <Selbaward.hpp>
 
+#include <common/Camera.hpp>
+#include <common/InplaceFunction.hpp>
+#include <common/ObjectPool.hpp>
+#include <common/Random.hpp>
+#include <common/SharedAnimations.hpp>
+#include <common/SpriteBatch.hpp>
+
 class Doodle;
 class Items;
 class Tile;
@@ -26,6 +33,8 @@ class Item : public sf::Sprite
 		void setRotation(float rotation);
 		sf::Vector2f getPosition() const;
 		sf::Vector2f getVelocity() const;
+		sf::Vector2f getDisplacement() const;
+		void landAt(float time);
 		void setVelocity(sf::Vector2f velocity);
 		void move(sf::Vector2f offset);
 		auto getBodyStatus() const;
@@ -47,7 +56,7 @@ class Item : public sf::Sprite
 
 public:
 
-	using OnDoodleCollisionFunctionType = std::function<void(Doodle*)>;
+	using OnDoodleCollisionFunctionType = InplaceFunction<void(Doodle*)>;
 	Item();
 	Item(sf::Texture* texture_ptr);
 	Item(const Item&) = default;
@@ -66,8 +75,10 @@ public:
 	virtual ~Item() = default;
 
 protected:
+	void setAnimations(std::shared_ptr<const SpriteAnimationMap> animations);
+
 	DoodleManipulator m_doodle_manip{nullptr};
-	std::shared_ptr<thor::AnimationMap<sf::Sprite, std::string>> m_animations;
+	std::shared_ptr<const SpriteAnimationMap> m_animations;
 	thor::Animator<sf::Sprite, std::string> m_animator;
 	sf::FloatRect m_collision_box{};
 	float m_texture_scale{ 0.65 };
@@ -81,12 +92,15 @@ protected:
 
 private:
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
+	sf::Vector2f m_previous_position{};
 
 	friend class Items;
 	friend class Doodle;
+	friend class CollisionWorld;
 };
 
-class Spring : public Item
+class Spring : public Item, public Pooled<Spring>
 {
 	float m_jumping_speed{ 1200 };
 public:
@@ -94,7 +108,7 @@ public:
 	void update(sf::Time dt) override;
 };
 
-class Trampoline : public Item
+class Trampoline : public Item, public Pooled<Trampoline>
 {
 	float m_jumping_speed{ 1500 };
 	sf::Time m_existing_time{}, m_doodle_rotation_start{}, m_doodle_rotation_duration{sf::seconds(1)};
@@ -107,7 +121,7 @@ public:
 	void update(sf::Time dt) override;
 };
 
-class PropellerHat : public Item
+class PropellerHat : public Item, public Pooled<PropellerHat>
 {
 	sf::Vector2f m_doodle_offset{ 0, -30 };
 	sf::Time m_existing_time{}, m_use_start{}, m_use_duration{ sf::seconds(3) };
@@ -127,7 +141,7 @@ public:
 	~PropellerHat();
 };
 
-class Jetpack : public Item
+class Jetpack : public Item, public Pooled<Jetpack>
 {
 	sf::Sprite m_body;
 	sf::Vector2f m_doodle_offset{ -29, 27 };
@@ -139,7 +153,7 @@ class Jetpack : public Item
 	float m_after_use_horizontal_speed{ 100 };
 	float getDoodleSpeed(float progress);
 
-	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 
 public:
 	Jetpack(Tile* tile);
@@ -154,7 +168,7 @@ public:
 class Tiles;
 class Monster;
 class Monsters;
-class SpringShoes : public Item
+class SpringShoes : public Item, public Pooled<SpringShoes>
 {
 	sw::GallerySprite m_shoes;
 	sf::Vector2f m_doodle_offset{ 0, 34 };
@@ -169,7 +183,7 @@ class SpringShoes : public Item
 	float getCurrentCompressionWithoutClamp();
 	float getCurrentCompression();
 
-	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 
 public:
 	SpringShoes(Tile* tile, size_t max_use_count, Tiles* tiles, Monsters* monsters);
@@ -181,13 +195,14 @@ public:
 	~SpringShoes();
 };
 
-class Shield : public Item
+class Shield : public Item, public Pooled<Shield>
 {
 	sf::Time m_existing_time{}, m_use_start{}, m_end_start{sf::seconds(8)}, m_use_duration{sf::seconds(10)};
 	bool m_is_destroyed{ false };
+	RandomEngine m_random;
 
 public:
-	Shield(Tile* tile);
+	Shield(Tile* tile, RandomEngine random);
 	void update(sf::Time dt) override;
 	bool isDestroyed() const override;
 	~Shield();
@@ -199,16 +214,21 @@ class Items : public sf::Drawable
 {
 private:
 	std::deque<std::unique_ptr<Item>> m_items;
-	sf::RenderWindow& m_game_window;
+	const Camera& m_camera;
+	float m_interpolation_alpha{ 1 };
+	std::vector<bool> m_is_removed{};
 
 public:
-	Items(sf::RenderWindow& game_window);
+	Items(const Camera& camera);
+	void add(Item* item);
+	void clear();
 	void update(sf::Time dt);
-	void updateDoodleCollisions(Doodle* doodle);
+	void setInterpolationAlpha(float alpha);
 	size_t getItemsCount();
 
 private:
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 	friend class Level;
 	friend class LevelGenerator;
+	friend class CollisionWorld;
 };
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <SFML/Graphics.hpp>
+
+#include <common/Utils.hpp>
+
+//what the swept feet of the doodle landed on, and when (from 0 to 1 along the displacement they were swept by)
+template<class T>
+struct Landing
+{
+	T* object{ nullptr };
+	float time{ 1 };
+
+	explicit operator bool() const { return object; }
+};
+
+//the bottom line of the feet is swept back along the displacement against the candidates (tiles or monsters), they are tried in the order the feet hit them
+//the first one that accepts the feet (moved to where they hit it) is landed on, the feet go on past the others (like through a decayed tile)
+//the hits are collected in the given buffer, so the caller keeps it between the ticks
+template<class T, class Accepts>
+Landing<T> findLanding(sf::FloatRect doodle_feet, sf::Vector2f displacement, const std::vector<T*>& candidates, std::vector<std::pair<float, T*>>& hits, Accepts accepts)
+{
+	sf::FloatRect feet_line{ doodle_feet.left, doodle_feet.top + doodle_feet.height - 1, doodle_feet.width, 1 };
+	hits.clear();
+	for (T* candidate : candidates)
+		if (auto time = utils::getSweptCollisionTime(feet_line, displacement, candidate->getCollisionBox())) hits.emplace_back(*time, candidate);
+	std::stable_sort(hits.begin(), hits.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+	for (auto [time, candidate] : hits)
+	{
+		sf::FloatRect feet_at_hit = doodle_feet;
+		feet_at_hit.left -= displacement.x * (1 - time);
+		feet_at_hit.top -= displacement.y * (1 - time);
+		if (accepts(candidate, feet_at_hit)) return { candidate, time };
+	}
+	return {};
+}
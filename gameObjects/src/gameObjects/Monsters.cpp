@@ -1,15 +1,19 @@
 #include "Monsters.hpp"
 
+#include <vector>
+#include <algorithm>
+
 #include <Thor/Math.hpp>
 
 #include <common/Resources.hpp>
+#include <common/Profiler.hpp>
 #include <gameObjects/Doodle.hpp>
 
 Monster::Monster() :Monster(nullptr)
 {}
 
 Monster::Monster(sf::Texture* texture_ptr) :
-	m_animations(new thor::AnimationMap<sf::Sprite, std::string>()),
+	m_animations(getSharedAnimations([](SpriteAnimationMap&) {})),
 	m_animator(*m_animations)
 {
 	if (texture_ptr) setTexture(*texture_ptr);
@@ -20,6 +24,13 @@ Monster::Monster(sf::Texture* texture_ptr) :
 	};
 }
 
+void Monster::setAnimations(std::shared_ptr<const SpriteAnimationMap> animations)
+{
+	//the animator points to the map it plays from
+	m_animations = std::move(animations);
+	m_animator = thor::Animator<sf::Sprite, std::string>(*m_animations);
+}
+
 sf::FloatRect Monster::getCollisionBox() const
 {
 	return m_collision_box;
@@ -35,7 +46,7 @@ bool Monster::isDestroyed() const
 	return m_is_destroyed;
 }
 
-bool Monster::getShooted(const Bullet& bullet)
+bool Monster::getShooted(sf::FloatRect bullet_box)
 {
 	m_is_dead = true;
 	m_is_destroyed = true;
@@ -75,15 +86,21 @@ void Monster::setDoodleBumpCallback(OnDoodleBumpFunctionType on_doodle_bump)
 
 void Monster::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	target.draw(sf::Sprite(*this), states);
+	SpriteBatch batch(target, states);
+	addToBatch(batch, {});
+}
+
+void Monster::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
+{
+	batch.add(*this, offset);
 }
 
 BlueOneEyedMonster::BlueOneEyedMonster(float speed) :
-	Monster(&global_sprites["monsters_blue_one_eyed"].getTexture()),
+	Monster(&global_sprites.at("monsters_blue_one_eyed").getTexture()),
 	m_speed(speed)
 {
 	m_collision_box_size = sf::Vector2f{ 74, 78 } *m_texture_scale;
-	setTextureRect(global_sprites["monsters_blue_one_eyed"].texture_rect);
+	setTextureRect(global_sprites.at("monsters_blue_one_eyed").texture_rect);
 	setOrigin({ 37, 49 });
 	setScale(m_texture_scale, m_texture_scale);
 }
@@ -127,10 +144,10 @@ void BlueOneEyedMonster::updateMovingLocation(float left, float right)
 }
 
 CamronMonster::CamronMonster() :
-	Monster(&global_sprites["monsters_camron"].getTexture())
+	Monster(&global_sprites.at("monsters_camron").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{76, 52} * m_texture_scale;
-	setTextureRect(global_sprites["monsters_camron"].texture_rect);
+	setTextureRect(global_sprites.at("monsters_camron").texture_rect);
 	setOrigin({ 44, 35 });
 	setScale(m_texture_scale, m_texture_scale);
 }
@@ -150,10 +167,10 @@ void CamronMonster::update(sf::Time dt)
 }
 
 PurpleSpiderMonster::PurpleSpiderMonster() :
-	Monster(&global_sprites["monsters_purple_spider"].getTexture())
+	Monster(&global_sprites.at("monsters_purple_spider").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 70, 110 } *m_texture_scale;
-	setTextureRect(global_sprites["monsters_purple_spider"].texture_rect);
+	setTextureRect(global_sprites.at("monsters_purple_spider").texture_rect);
 	setOrigin({ 55, 49 });
 	setScale(m_texture_scale, m_texture_scale);
 }
@@ -173,10 +190,10 @@ void PurpleSpiderMonster::update(sf::Time dt)
 }
 
 LargeBlueMonster::LargeBlueMonster():
-	Monster(&global_sprites["monsters_large_blue"].getTexture())
+	Monster(&global_sprites.at("monsters_large_blue").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 130, 106 } *m_texture_scale;
-	setTextureRect(global_sprites["monsters_large_blue"].texture_rect);
+	setTextureRect(global_sprites.at("monsters_large_blue").texture_rect);
 	setOrigin(85, 106);
 	setScale(m_texture_scale, m_texture_scale);
 }
@@ -196,15 +213,16 @@ void LargeBlueMonster::update(sf::Time dt)
 	m_collision_box = sf::FloatRect(getPosition() - sf::Vector2f{m_collision_box_size.x / 2.f, m_collision_box_size.y}, m_collision_box_size);
 }
 
-UFO::UFO() :
-	Monster(&global_sprites["monsters_ufo_0"].getTexture()),
-	m_light(global_sprites["monsters_ufo_0"].getTexture())
+UFO::UFO(RandomEngine random) :
+	Monster(&global_sprites.at("monsters_ufo_0").getTexture()),
+	m_light(global_sprites.at("monsters_ufo_0").getTexture()),
+	m_random(random)
 {
 	m_collision_box_size = sf::Vector2f{ 160, 240 } *m_texture_scale;
-	setTextureRect(global_sprites["monsters_ufo_0"].texture_rect);
+	setTextureRect(global_sprites.at("monsters_ufo_0").texture_rect);
 	setOrigin({ 78, 34 });
 	setScale(m_texture_scale, m_texture_scale);
-	m_light.setTextureRect(global_sprites["monsters_ufo_1"].texture_rect);
+	m_light.setTextureRect(global_sprites.at("monsters_ufo_1").texture_rect);
 	m_light.setOrigin(80, 0);
 	m_light.setScale(m_texture_scale, m_texture_scale);
 	setDoodleJumpCallback([this](sf::FloatRect doodle_feet)
@@ -260,28 +278,28 @@ void UFO::update(sf::Time dt)
 	m_UFO_collision_boxes[1] = sf::FloatRect(getPosition() + m_UFO_collision_box_offsets[1], m_UFO_collision_box_sizes[1]);
 	m_light_collision_box = sf::FloatRect(getPosition() + m_light_collision_box_offset, m_light_collision_box_size);
 	m_light.setPosition(getPosition());
-	m_light.setColor({ 255, 255, 255, sf::Uint8((thor::Distributions::uniform(0, 1)()) ? 255 : 128) });
+	m_light.setColor({ 255, 255, 255, sf::Uint8(m_random.chance(0.5f) ? 255 : 128) });
 }
 
-bool UFO::getShooted(const Bullet& bullet)
+bool UFO::getShooted(sf::FloatRect bullet_box)
 {
-	if (bullet.getGlobalBounds().intersects(m_UFO_collision_boxes[0]) ||
-		bullet.getGlobalBounds().intersects(m_UFO_collision_boxes[1]))
-		return Monster::getShooted(bullet);
+	if (bullet_box.intersects(m_UFO_collision_boxes[0]) ||
+		bullet_box.intersects(m_UFO_collision_boxes[1]))
+		return Monster::getShooted(bullet_box);
 	return false;
 }
 
-void UFO::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void UFO::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
 {
-	target.draw(m_light, states);
-	target.draw(sf::Sprite(*this), states);
+	batch.add(m_light, offset);
+	batch.add(*this, offset);
 }
 
 BlackHole::BlackHole() :
-	Monster(&global_sprites["monsters_black_hole"].getTexture())
+	Monster(&global_sprites.at("monsters_black_hole").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 110, 90 } *m_texture_scale;
-	setTextureRect(global_sprites["monsters_black_hole"].texture_rect);
+	setTextureRect(global_sprites.at("monsters_black_hole").texture_rect);
 	setOrigin({ 70, 65 });
 	setScale(m_texture_scale, m_texture_scale);
 	setDoodleJumpCallback([](sf::FloatRect) {return false; });
@@ -299,28 +317,31 @@ void BlackHole::update(sf::Time dt)
 	if (m_doodle && !m_doodle->isDead()) m_doodle = nullptr;
 }
 
-bool BlackHole::getShooted(const Bullet& bullet)
+bool BlackHole::getShooted(sf::FloatRect bullet_box)
 {
 	return false;
 }
 
-void BlackHole::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void BlackHole::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
 {
-	target.draw(Sprite(*this), states);
-	if (m_doodle) target.draw(*m_doodle, states);
+	batch.add(*this, offset);
+	if (m_doodle) batch.draw(*m_doodle, offset);
 }
 
 OvalGreenMonster::OvalGreenMonster():
-	Monster(&global_sprites["monsters_oval_green_0"].getTexture())
+	Monster(&global_sprites.at("monsters_oval_green_0").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 92, 168 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["monsters_oval_green_0"].texture_rect, { 62, 168 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation hurting_animation;
-	hurting_animation.addFrame(1, global_sprites["monsters_oval_green_1"].texture_rect, { 62, 168 });
-	m_animations->addAnimation("hurting", hurting_animation, sf::seconds(0.1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("monsters_oval_green_0").texture_rect, { 62, 168 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation hurting_animation;
+		hurting_animation.addFrame(1, global_sprites.at("monsters_oval_green_1").texture_rect, { 62, 168 });
+		animations.addAnimation("hurting", hurting_animation, sf::seconds(0.1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -341,25 +362,28 @@ void OvalGreenMonster::update(sf::Time dt)
 	m_collision_box = sf::FloatRect(getPosition() - sf::Vector2f{ m_collision_box_size.x / 2.f, m_collision_box_size.y }, m_collision_box_size);
 }
 
-bool OvalGreenMonster::getShooted(const Bullet& bullet)
+bool OvalGreenMonster::getShooted(sf::FloatRect bullet_box)
 {
 	m_hp--;
 	if (m_hp > 0) m_animator.play() << "hurting" << thor::Playback::loop("default");
-	else Monster::getShooted(bullet);
+	else Monster::getShooted(bullet_box);
 	return true;
 }
 
 FlatGreenMonster::FlatGreenMonster() :
-	Monster(&global_sprites["monsters_flat_green_0"].getTexture())
+	Monster(&global_sprites.at("monsters_flat_green_0").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 182, 48 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["monsters_flat_green_0"].texture_rect, { 91, 62 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation hurting_animation;
-	hurting_animation.addFrame(1, global_sprites["monsters_flat_green_1"].texture_rect, { 91, 62 });
-	m_animations->addAnimation("hurting", hurting_animation, sf::seconds(0.1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("monsters_flat_green_0").texture_rect, { 91, 62 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation hurting_animation;
+		hurting_animation.addFrame(1, global_sprites.at("monsters_flat_green_1").texture_rect, { 91, 62 });
+		animations.addAnimation("hurting", hurting_animation, sf::seconds(0.1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -379,31 +403,34 @@ void FlatGreenMonster::update(sf::Time dt)
 	m_collision_box = sf::FloatRect(getPosition() - sf::Vector2f{ m_collision_box_size.x / 2.f, m_collision_box_size.y }, m_collision_box_size);
 }
 
-bool FlatGreenMonster::getShooted(const Bullet& bullet)
+bool FlatGreenMonster::getShooted(sf::FloatRect bullet_box)
 {
 	m_hp--;
 	if (m_hp > 0) m_animator.play() << "hurting" << thor::Playback::loop("default");
-	else Monster::getShooted(bullet);
+	else Monster::getShooted(bullet_box);
 	return true;
 }
 
 LargeGreenMonster::LargeGreenMonster() :
-	Monster(&global_sprites["monsters_large_green_0"].getTexture())
+	Monster(&global_sprites.at("monsters_large_green_0").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 150, 96 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["monsters_large_green_0"].texture_rect, { 81, 102 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation hurting_animation;
-	hurting_animation.addFrame(1, global_sprites["monsters_large_green_1"].texture_rect, { 81, 102 });
-	hurting_animation.addFrame(1, global_sprites["monsters_large_green_2"].texture_rect, { 81, 102 });
-	m_animations->addAnimation("hurting", hurting_animation, sf::seconds(0.3));
-	thor::FrameAnimation dead_animation;
-	dead_animation.addFrame(1, global_sprites["monsters_large_green_1"].texture_rect, { 81, 102 });
-	dead_animation.addFrame(1, global_sprites["monsters_large_green_3"].texture_rect, { 81, 102 });
-	dead_animation.addFrame(1, global_sprites["monsters_large_green_4"].texture_rect, { 81, 102 });
-	m_animations->addAnimation("dead", dead_animation, sf::seconds(0.3));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("monsters_large_green_0").texture_rect, { 81, 102 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation hurting_animation;
+		hurting_animation.addFrame(1, global_sprites.at("monsters_large_green_1").texture_rect, { 81, 102 });
+		hurting_animation.addFrame(1, global_sprites.at("monsters_large_green_2").texture_rect, { 81, 102 });
+		animations.addAnimation("hurting", hurting_animation, sf::seconds(0.3));
+		thor::FrameAnimation dead_animation;
+		dead_animation.addFrame(1, global_sprites.at("monsters_large_green_1").texture_rect, { 81, 102 });
+		dead_animation.addFrame(1, global_sprites.at("monsters_large_green_3").texture_rect, { 81, 102 });
+		dead_animation.addFrame(1, global_sprites.at("monsters_large_green_4").texture_rect, { 81, 102 });
+		animations.addAnimation("dead", dead_animation, sf::seconds(0.3));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -416,7 +443,7 @@ void LargeGreenMonster::update(sf::Time dt)
 	m_collision_box = sf::FloatRect(getPosition() - sf::Vector2f{ m_collision_box_size.x / 2.f, m_collision_box_size.y }, m_collision_box_size);
 }
 
-bool LargeGreenMonster::getShooted(const Bullet& bullet)
+bool LargeGreenMonster::getShooted(sf::FloatRect bullet_box)
 {
 	m_hp--;
 	if (m_hp > 0) m_animator.play() << thor::Playback::loop("hurting");
@@ -429,20 +456,23 @@ bool LargeGreenMonster::getShooted(const Bullet& bullet)
 }
 
 BlueWingedMonster::BlueWingedMonster() :
-	Monster(&global_sprites["monsters_blue_winged_0"].getTexture())
+	Monster(&global_sprites.at("monsters_blue_winged_0").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 156, 68 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_0"].texture_rect, { 78, 44 });
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_1"].texture_rect, { 78, 44 });
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_2"].texture_rect, { 78, 44 });
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_3"].texture_rect, { 78, 44 });
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_4"].texture_rect, { 78, 44 });
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_3"].texture_rect, { 78, 44 });
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_2"].texture_rect, { 78, 44 });
-	default_animation.addFrame(1, global_sprites["monsters_blue_winged_1"].texture_rect, { 78, 44 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(0.1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_0").texture_rect, { 78, 44 });
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_1").texture_rect, { 78, 44 });
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_2").texture_rect, { 78, 44 });
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_3").texture_rect, { 78, 44 });
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_4").texture_rect, { 78, 44 });
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_3").texture_rect, { 78, 44 });
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_2").texture_rect, { 78, 44 });
+		default_animation.addFrame(1, global_sprites.at("monsters_blue_winged_1").texture_rect, { 78, 44 });
+		animations.addAnimation("default", default_animation, sf::seconds(0.1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -464,22 +494,25 @@ void BlueWingedMonster::update(sf::Time dt)
 }
 
 TheTerrifyingMonster::TheTerrifyingMonster(sf::Vector2f speed) :
-	Monster(&global_sprites["monsters_the_terrifying_0"].getTexture()),
+	Monster(&global_sprites.at("monsters_the_terrifying_0").getTexture()),
 	m_speed(speed)
 {
 	m_collision_box_size = sf::Vector2f{ 86, 174 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["monsters_the_terrifying_0"].texture_rect, { 63, 87 });
-	default_animation.addFrame(1, global_sprites["monsters_the_terrifying_1"].texture_rect, { 63, 87 });
-	default_animation.addFrame(1, global_sprites["monsters_the_terrifying_2"].texture_rect, { 63, 87 });
-	default_animation.addFrame(1, global_sprites["monsters_the_terrifying_3"].texture_rect, { 67, 87 });
-	default_animation.addFrame(1, global_sprites["monsters_the_terrifying_2"].texture_rect, { 63, 87 });
-	default_animation.addFrame(1, global_sprites["monsters_the_terrifying_1"].texture_rect, { 63, 87 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(0.3)); 
-	thor::FrameAnimation hurting_animation;
-	hurting_animation.addFrame(1, global_sprites["monsters_the_terrifying_4"].texture_rect, { 63, 87 });
-	m_animations->addAnimation("hurting", hurting_animation, sf::seconds(0.1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("monsters_the_terrifying_0").texture_rect, { 63, 87 });
+		default_animation.addFrame(1, global_sprites.at("monsters_the_terrifying_1").texture_rect, { 63, 87 });
+		default_animation.addFrame(1, global_sprites.at("monsters_the_terrifying_2").texture_rect, { 63, 87 });
+		default_animation.addFrame(1, global_sprites.at("monsters_the_terrifying_3").texture_rect, { 67, 87 });
+		default_animation.addFrame(1, global_sprites.at("monsters_the_terrifying_2").texture_rect, { 63, 87 });
+		default_animation.addFrame(1, global_sprites.at("monsters_the_terrifying_1").texture_rect, { 63, 87 });
+		animations.addAnimation("default", default_animation, sf::seconds(0.3));
+		thor::FrameAnimation hurting_animation;
+		hurting_animation.addFrame(1, global_sprites.at("monsters_the_terrifying_4").texture_rect, { 63, 87 });
+		animations.addAnimation("hurting", hurting_animation, sf::seconds(0.1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -503,11 +536,11 @@ void TheTerrifyingMonster::update(sf::Time dt)
 	m_collision_box = sf::FloatRect(getPosition() - m_collision_box_size / 2.f, m_collision_box_size);
 }
 
-bool TheTerrifyingMonster::getShooted(const Bullet& bullet)
+bool TheTerrifyingMonster::getShooted(sf::FloatRect bullet_box)
 {
 	m_hp--;
 	if (m_hp > 0) m_animator.play() << "hurting" << thor::Playback::loop("default");
-	else Monster::getShooted(bullet);
+	else Monster::getShooted(bullet_box);
 	return true;
 }
 
@@ -523,51 +556,59 @@ void TheTerrifyingMonster::updateMovingLocation(float left, float right)
 	m_right = right;
 }
 
-Monsters::Monsters(sf::RenderWindow& game_window):
-	m_game_window(game_window)
+Monsters::Monsters(const Camera& camera):
+	m_camera(camera)
 {
 }
 
-void Monsters::update(sf::Time dt)
+void Monsters::add(Monster* monster)
 {
-	for (auto& monster : m_monsters)
-	{
-		monster->update(dt);
-		if (sf::FloatRect area = utils::getViewArea(m_game_window); monster->getCollisionBox().top > area.top + area.height)
-			monster->m_is_fallen_off_screen = true;
-	}
-
-	for (size_t i = 0; i < m_monsters.size(); i++)
-		if (sf::FloatRect area = utils::getViewArea(m_game_window); m_monsters[i]->isDestroyed() || m_monsters[i]->getCollisionBox().top > area.top + area.height)
-			m_monsters.erase(m_monsters.begin() + i--);
+	m_monsters.emplace_back(monster);
+	monster->m_previous_position = monster->getPosition();
 }
 
-Monster* Monsters::getMonsterDoodleWillJump(sf::FloatRect doodle_feet)
+void Monsters::clear()
 {
-	Monster* res_monster{ nullptr };
-	sf::FloatRect feet{ doodle_feet.left, doodle_feet.top + doodle_feet.height - 1, doodle_feet.width, 1 };
-	for (const auto& monster : m_monsters) if (monster->getCollisionBox().intersects(feet)) res_monster = (monster->m_on_doodle_jump(doodle_feet) ? monster.get() : nullptr);
-	return res_monster;
+	m_monsters.clear();
 }
 
-bool Monsters::willDoodleJump(sf::FloatRect doodle_feet)
+void Monsters::update(sf::Time dt)
 {
-	return getMonsterDoodleWillJump(doodle_feet);
+	PROFILE_SCOPE("Monsters::update");
+	sf::FloatRect area = m_camera.getSnapshot().view_area;
+	m_is_removed.assign(m_monsters.size(), false);
+	for (size_t i = 0; i < m_monsters.size(); i++)
+	{
+		Monster& monster = *m_monsters[i];
+		monster.m_previous_position = monster.getPosition();
+		monster.update(dt);
+
+		bool is_below_view = monster.getCollisionBox().top > area.top + area.height;
+		if (is_below_view) monster.m_is_fallen_off_screen = true;
+		m_is_removed[i] = monster.isDestroyed() || is_below_view;
+	}
+
+	//one pass over the monsters and their flags, the kept ones keep their order
+	size_t kept = 0;
+	for (size_t i = 0; i < m_monsters.size(); i++)
+	{
+		if (m_is_removed[i]) continue;
+		if (kept != i) m_monsters[kept] = std::move(m_monsters[i]);
+		kept++;
+	}
+	m_monsters.resize(kept);
 }
 
-bool Monsters::updateBullet(const Bullet& bullet)
+void Monsters::setInterpolationAlpha(float alpha)
 {
-	bool res = false;
-	for (auto& monster : m_monsters) if (monster->getCollisionBox().intersects(bullet.getGlobalBounds())) res |= monster->getShooted(bullet);
-	return res;
+	m_interpolation_alpha = alpha;
 }
 
-void Monsters::updateDoodleBump(Doodle* doodle)
+Landing<Monster> Monsters::getMonsterDoodleWillJump(sf::FloatRect doodle_feet, sf::Vector2f displacement)
 {
-	for (auto& monster : m_monsters)
-		if (monster->getCollisionBox().intersects(doodle->getFeetCollisionBox())
-			|| monster->getCollisionBox().intersects(doodle->getBodyCollisionBox()))
-			monster->m_on_doodle_bump(doodle);
+	m_candidates.clear();
+	for (const auto& monster : m_monsters) m_candidates.push_back(monster.get());
+	return findLanding(doodle_feet, displacement, m_candidates, m_hits, [](Monster* monster, sf::FloatRect feet_at_hit) { return monster->m_on_doodle_jump(feet_at_hit); });
 }
 
 size_t Monsters::getMonstersCount()
@@ -577,9 +618,10 @@ size_t Monsters::getMonstersCount()
 
 void Monsters::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+	SpriteBatch batch(target, states);
 	for (const auto& monster : m_monsters)
 	{
-		target.draw(*monster, states);
+		monster->addToBatch(batch, utils::getInterpolationOffset(monster->m_previous_position, monster->getPosition(), m_interpolation_alpha));
 		/*sf::RectangleShape sh{ {monster->getCollisionBox().width, monster->getCollisionBox().height} };
 		sh.setPosition(monster->getCollisionBox().left, monster->getCollisionBox().top);
 		sh.setFillColor(sf::Color(255, 0, 0, 100));
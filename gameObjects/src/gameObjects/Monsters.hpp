@@ -1,22 +1,28 @@
 #pragma once
 #include <string>
 #include <deque>
+#include <vector>
 #include <functional>
 
 #include <SFML/Graphics.hpp>
 #include <Thor/Animations.hpp>
 
+#include <common/Camera.hpp>
+#include <common/InplaceFunction.hpp>
+#include <common/ObjectPool.hpp>
 #include <common/Utils.hpp>
+#include <common/SharedAnimations.hpp>
+#include <common/SpriteBatch.hpp>
+#include <gameObjects/Landing.hpp>
 
 class Monsters;
 class Doodle;
-class Bullet;
 class Monster : public sf::Sprite
 {
 public:
-	using SpecUpdateFunctionType = std::function<void(sf::Time)>;
-	using OnDoodleJumpFunctionType = std::function<bool(sf::FloatRect)>;
-	using OnDoodleBumpFunctionType = std::function<void(Doodle*)>;
+	using SpecUpdateFunctionType = InplaceFunction<void(sf::Time)>;
+	using OnDoodleJumpFunctionType = InplaceFunction<bool(sf::FloatRect)>;
+	using OnDoodleBumpFunctionType = InplaceFunction<void(Doodle*)>;
 	
 	Monster();
 	Monster(sf::Texture* texture_ptr);
@@ -28,7 +34,7 @@ public:
 	sf::FloatRect getCollisionBox() const;
 	sf::Vector2f getCollisionBoxSize() const;
 	bool isDestroyed() const;
-	virtual bool getShooted(const Bullet& bullet);
+	virtual bool getShooted(sf::FloatRect bullet_box);
 	bool isFallenOffScreen() const;
 	bool isDead() const;
 	virtual void update(sf::Time) = 0;
@@ -40,7 +46,9 @@ public:
 	virtual ~Monster() = default;
 
 protected:
-	std::shared_ptr<thor::AnimationMap<sf::Sprite, std::string>> m_animations;
+	void setAnimations(std::shared_ptr<const SpriteAnimationMap> animations);
+
+	std::shared_ptr<const SpriteAnimationMap> m_animations;
 	thor::Animator<sf::Sprite, std::string> m_animator;
 	sf::FloatRect m_collision_box{};
 	sf::Vector2f m_collision_box_size{};
@@ -64,12 +72,15 @@ protected:
 
 private:
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 	bool m_is_fallen_off_screen{ 0 };
+	sf::Vector2f m_previous_position{};
 
 	friend class Monsters;
+	friend class CollisionWorld;
 };
 
-class BlueOneEyedMonster : public Monster
+class BlueOneEyedMonster : public Monster, public Pooled<BlueOneEyedMonster>
 {
 	float m_speed;
 	float m_left{ 0 }, m_right{ -1 };
@@ -82,7 +93,7 @@ public:
 	void updateMovingLocation(float left, float right);
 };
 
-class CamronMonster : public Monster
+class CamronMonster : public Monster, public Pooled<CamronMonster>
 {
 	sf::Time m_oscillation_time{ sf::seconds(0.5) };
 	float m_oscillation_size{ 15 };
@@ -91,7 +102,7 @@ public:
 	void update(sf::Time dt) override;
 };
 
-class PurpleSpiderMonster : public Monster
+class PurpleSpiderMonster : public Monster, public Pooled<PurpleSpiderMonster>
 {
 	sf::Time m_oscillation_time{ sf::seconds(0.5) };
 	float m_oscillation_size{ 15 };
@@ -100,7 +111,7 @@ public:
 	void update(sf::Time dt) override;
 };
 
-class LargeBlueMonster : public Monster
+class LargeBlueMonster : public Monster, public Pooled<LargeBlueMonster>
 {
 	sf::Time m_oscillation_time{ sf::seconds(1) };
 	sf::Vector2f m_oscillation_size{ 15, 15 };
@@ -109,7 +120,7 @@ public:
 	void update(sf::Time dt) override;
 };
 
-class UFO : public Monster
+class UFO : public Monster, public Pooled<UFO>
 {
 	sf::Time m_oscillation_time{ sf::seconds(4) };
 	sf::Vector2f m_oscillation_size{ 40, 20 };
@@ -130,29 +141,30 @@ class UFO : public Monster
 	sf::FloatRect m_UFO_collision_boxes[2];
 	sf::FloatRect m_light_collision_box;
 	sf::Sprite m_light;
+	RandomEngine m_random;
 public:
-	UFO();
+	UFO(RandomEngine random);
 	void update(sf::Time dt) override;
-	bool getShooted(const Bullet& bullet) override;
+	bool getShooted(sf::FloatRect bullet_box) override;
 
 private:
-	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 };
 
-class BlackHole : public Monster
+class BlackHole : public Monster, public Pooled<BlackHole>
 {
 	sf::Vector2f m_collision_box_offset{ sf::Vector2f{-55, -52}*m_texture_scale };
 	Doodle* m_doodle{ nullptr };
 public:
 	BlackHole();
 	void update(sf::Time dt) override;
-	bool getShooted(const Bullet& bullet) override;
+	bool getShooted(sf::FloatRect bullet_box) override;
 
 private:
-	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 };
 
-class OvalGreenMonster: public Monster
+class OvalGreenMonster : public Monster, public Pooled<OvalGreenMonster>
 {
 	sf::Time m_oscillation_time{ sf::seconds(1) };
 	sf::Vector2f m_oscillation_size{ 15, 15 };
@@ -161,10 +173,10 @@ class OvalGreenMonster: public Monster
 public:
 	OvalGreenMonster();
 	void update(sf::Time dt) override;
-	bool getShooted(const Bullet& bullet) override;
+	bool getShooted(sf::FloatRect bullet_box) override;
 };
 
-class FlatGreenMonster: public Monster
+class FlatGreenMonster : public Monster, public Pooled<FlatGreenMonster>
 {
 	sf::Time m_oscillation_time{ sf::seconds(1) };
 	float m_oscillation_size{ 15 };
@@ -173,20 +185,20 @@ class FlatGreenMonster: public Monster
 public:
 	FlatGreenMonster();
 	void update(sf::Time dt) override;
-	bool getShooted(const Bullet& bullet) override;
+	bool getShooted(sf::FloatRect bullet_box) override;
 };
 
-class LargeGreenMonster : public Monster
+class LargeGreenMonster : public Monster, public Pooled<LargeGreenMonster>
 {
 	int m_hp = 2;
 
 public:
 	LargeGreenMonster();
 	void update(sf::Time dt) override;
-	bool getShooted(const Bullet& bullet) override;
+	bool getShooted(sf::FloatRect bullet_box) override;
 };
 
-class BlueWingedMonster: public Monster
+class BlueWingedMonster : public Monster, public Pooled<BlueWingedMonster>
 {
 	sf::Time m_oscillation_time{ sf::seconds(0.5) };
 	float m_oscillation_size{ 15 };
@@ -196,7 +208,7 @@ public:
 	void update(sf::Time dt) override;
 };
 
-class TheTerrifyingMonster : public Monster
+class TheTerrifyingMonster : public Monster, public Pooled<TheTerrifyingMonster>
 {
 	sf::Vector2f m_speed;
 	float m_left{ 0 }, m_right{ -1 };
@@ -205,7 +217,7 @@ class TheTerrifyingMonster : public Monster
 public:
 	TheTerrifyingMonster(sf::Vector2f speed);
 	void update(sf::Time dt) override;
-	bool getShooted(const Bullet& bullet) override;
+	bool getShooted(sf::FloatRect bullet_box) override;
 
 	void updateMovingLocation(sf::FloatRect area);
 	void updateMovingLocation(float left, float right);
@@ -217,20 +229,26 @@ class Monsters : public sf::Drawable
 {
 private:
 	std::deque<std::unique_ptr<Monster>> m_monsters;
-	sf::RenderWindow& m_game_window;
+	const Camera& m_camera;
+	float m_interpolation_alpha{ 1 };
+	std::vector<bool> m_is_removed{};
+	std::vector<Monster*> m_candidates{};
+	std::vector<std::pair<float, Monster*>> m_hits{};
 
 public:
-	Monsters(sf::RenderWindow& game_window);
+	Monsters(const Camera& camera);
+	void add(Monster* monster);
+	void clear();
 	void update(sf::Time dt);
-	Monster* getMonsterDoodleWillJump(sf::FloatRect doodle_feet);
-	bool willDoodleJump(sf::FloatRect doodle_feet);
-	bool updateBullet(const Bullet& bullet);
-	void updateDoodleBump(Doodle* doodle);
+	void setInterpolationAlpha(float alpha);
+	//the feet are swept by the displacement like in Tiles::getTileDoodleWillJump
+	Landing<Monster> getMonsterDoodleWillJump(sf::FloatRect doodle_feet, sf::Vector2f displacement = {});
 	size_t getMonstersCount();
 
 private:
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 	friend class Level;
 	friend class LevelGenerator;
+	friend class CollisionWorld;
 
 };
\ No newline at end of file
@@ -1,21 +1,33 @@
 #include "Tiles.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 #include <imgui.h>
 #include <Thor/Math.hpp>
 
 #include <common/Resources.hpp>
 #include <common/Utils.hpp>
+#include <common/Profiler.hpp>
 
 Tile::Tile() : Tile(nullptr)
 {}
 
 Tile::Tile(sf::Texture* texture_ptr):
-	m_animations(new thor::AnimationMap<sf::Sprite, std::string>()),
+	m_animations(getSharedAnimations([](SpriteAnimationMap&) {})),
 	m_animator(*m_animations)
 {
 	if (texture_ptr) setTexture(*texture_ptr);
 }
 
+void Tile::setAnimations(std::shared_ptr<const SpriteAnimationMap> animations)
+{
+	//the animator points to the map it plays from
+	m_animations = std::move(animations);
+	m_animator = thor::Animator<sf::Sprite, std::string>(*m_animations);
+}
+
 sf::FloatRect Tile::getCollisionBox() const
 {
 	return m_collision_box;
@@ -63,7 +75,8 @@ void Tile::setDoodleJumpCallback(OnDoodleJumpFunctionType on_doodle_jump)
 
 void Tile::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	target.draw(sf::Sprite(*this), states);
+	SpriteBatch batch(target, states);
+	addToBatch(batch, {});
 	/*sf::RectangleShape sh({ m_collision_box.width, m_collision_box.height });
 	sh.setOrigin(sf::Vector2f{ m_collision_box.width, m_collision_box.height } / 2.f);
 	sh.setFillColor(sf::Color(255, 0, 0, 100));
@@ -71,15 +84,23 @@ void Tile::draw(sf::RenderTarget& target, sf::RenderStates states) const
 	target.draw(sh);*/
 }
 
+void Tile::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
+{
+	batch.add(*this, offset);
+}
+
 
 NormalTile::NormalTile() :
-	Tile(&global_sprites["tiles_normal"].getTexture())
+	Tile(&global_sprites.at("tiles_normal").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 114, 30 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["tiles_normal"].texture_rect, {64, 20});
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("tiles_normal").texture_rect, {64, 20});
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -91,14 +112,17 @@ void NormalTile::update(sf::Time dt)
 }
 
 HorizontalSlidingTile::HorizontalSlidingTile(float speed):
-	Tile(&global_sprites["tiles_horizontal"].getTexture()),
+	Tile(&global_sprites.at("tiles_horizontal").getTexture()),
 	m_speed(speed)
 {
 	m_collision_box_size = sf::Vector2f{ 114, 30 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["tiles_horizontal"].texture_rect, {64, 20});
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("tiles_horizontal").texture_rect, {64, 20});
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -131,14 +155,17 @@ void HorizontalSlidingTile::updateMovingLocation(float left, float right)
 }
 
 VerticalSlidingTile::VerticalSlidingTile(float speed):
-	Tile(&global_sprites["tiles_vertical"].getTexture()),
+	Tile(&global_sprites.at("tiles_vertical").getTexture()),
 	m_speed(speed)
 {
 	m_collision_box_size = sf::Vector2f{ 114, 30 } *m_texture_scale;
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["tiles_vertical"].texture_rect, {64, 20});
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("tiles_vertical").texture_rect, {64, 20});
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
 }
 
@@ -174,7 +201,7 @@ DecayedTile::DecayedTile() : DecayedTile(0)
 {}
 
 DecayedTile::DecayedTile(float speed) :
-	Tile(&global_sprites["tiles_decayed_0"].getTexture()),
+	Tile(&global_sprites.at("tiles_decayed_0").getTexture()),
 	m_speed(speed)
 {
 	m_collision_box_size = sf::Vector2f{ 120, 30 } *m_texture_scale;
@@ -188,15 +215,18 @@ DecayedTile::DecayedTile(float speed) :
 		return false; 
 	});
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["tiles_decayed_0"].texture_rect, { 64, 20 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation breaking_animation;
-	breaking_animation.addFrame(1, global_sprites["tiles_decayed_0"].texture_rect, { 64, 20 });
-	breaking_animation.addFrame(1, global_sprites["tiles_decayed_1"].texture_rect, { 64, 20 });
-	breaking_animation.addFrame(1, global_sprites["tiles_decayed_2"].texture_rect, { 64, 20 });
-	breaking_animation.addFrame(1, global_sprites["tiles_decayed_3"].texture_rect, { 64, 20 });
-	m_animations->addAnimation("break", breaking_animation, sf::seconds(0.1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("tiles_decayed_0").texture_rect, { 64, 20 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation breaking_animation;
+		breaking_animation.addFrame(1, global_sprites.at("tiles_decayed_0").texture_rect, { 64, 20 });
+		breaking_animation.addFrame(1, global_sprites.at("tiles_decayed_1").texture_rect, { 64, 20 });
+		breaking_animation.addFrame(1, global_sprites.at("tiles_decayed_2").texture_rect, { 64, 20 });
+		breaking_animation.addFrame(1, global_sprites.at("tiles_decayed_3").texture_rect, { 64, 20 });
+		animations.addAnimation("break", breaking_animation, sf::seconds(0.1));
+	}));
 
 	m_animator.play() << thor::Playback::loop("default");
 }
@@ -231,7 +261,7 @@ void DecayedTile::updateMovingLocation(float left, float right)
 }
 
 BombTile::BombTile(float exploding_height):
-	Tile(&global_sprites["tiles_bomb_0"].getTexture()),
+	Tile(&global_sprites.at("tiles_bomb_0").getTexture()),
 	m_exploding_height(exploding_height)
 {
 	m_collision_box_size = sf::Vector2f{ 114, 30 } *m_texture_scale;
@@ -245,21 +275,24 @@ BombTile::BombTile(float exploding_height):
 		return !m_is_exploded;
 	});
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["tiles_bomb_0"].texture_rect, { 64, 20 });
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	thor::FrameAnimation preparing_animation;
-	preparing_animation.addFrame(1, global_sprites["tiles_bomb_0"].texture_rect, { 64, 20 });
-	preparing_animation.addFrame(1, global_sprites["tiles_bomb_1"].texture_rect, { 64, 20 });
-	preparing_animation.addFrame(1, global_sprites["tiles_bomb_2"].texture_rect, { 64, 20 });
-	preparing_animation.addFrame(1, global_sprites["tiles_bomb_3"].texture_rect, { 64, 20 });
-	preparing_animation.addFrame(10, global_sprites["tiles_bomb_4"].texture_rect, { 64, 20 });
-	m_animations->addAnimation("prepare", preparing_animation, sf::seconds(0.8));
-	thor::FrameAnimation exploding_animation;
-	exploding_animation.addFrame(1, global_sprites["tiles_bomb_5"].texture_rect, { 64, 20 });
-	exploding_animation.addFrame(1, global_sprites["tiles_bomb_6"].texture_rect, { 64, 30 });
-	exploding_animation.addFrame(1, global_sprites["tiles_bomb_7"].texture_rect, { 64, 30 });
-	m_animations->addAnimation("explode", exploding_animation, sf::seconds(0.2));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("tiles_bomb_0").texture_rect, { 64, 20 });
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		thor::FrameAnimation preparing_animation;
+		preparing_animation.addFrame(1, global_sprites.at("tiles_bomb_0").texture_rect, { 64, 20 });
+		preparing_animation.addFrame(1, global_sprites.at("tiles_bomb_1").texture_rect, { 64, 20 });
+		preparing_animation.addFrame(1, global_sprites.at("tiles_bomb_2").texture_rect, { 64, 20 });
+		preparing_animation.addFrame(1, global_sprites.at("tiles_bomb_3").texture_rect, { 64, 20 });
+		preparing_animation.addFrame(10, global_sprites.at("tiles_bomb_4").texture_rect, { 64, 20 });
+		animations.addAnimation("prepare", preparing_animation, sf::seconds(0.8));
+		thor::FrameAnimation exploding_animation;
+		exploding_animation.addFrame(1, global_sprites.at("tiles_bomb_5").texture_rect, { 64, 20 });
+		exploding_animation.addFrame(1, global_sprites.at("tiles_bomb_6").texture_rect, { 64, 30 });
+		exploding_animation.addFrame(1, global_sprites.at("tiles_bomb_7").texture_rect, { 64, 30 });
+		animations.addAnimation("explode", exploding_animation, sf::seconds(0.2));
+	}));
 
 	m_animator.play() << thor::Playback::loop("default");
 }
@@ -278,9 +311,10 @@ void BombTile::updateHeight(float current_height)
 	m_current_height = current_height;
 }
 
-void BombTile::updateHeight(sf::RenderWindow& window)
+void BombTile::updateHeight(const Camera& camera)
 {
-	updateHeight(window.mapCoordsToPixel(getPosition()).y - window.getSize().y / 2.f);
+	const Camera::Snapshot& snapshot = camera.getSnapshot();
+	updateHeight(snapshot.mapCoordsToPixel(getPosition()).y - snapshot.size.y / 2.f);
 }
 
 bool BombTile::isDestroyed() const
@@ -299,7 +333,7 @@ void BombTile::startExploding()
 }
 
 OneTimeTile::OneTimeTile():
-	Tile(&global_sprites["tiles_one_time"].getTexture())
+	Tile(&global_sprites.at("tiles_one_time").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 114, 30 } *m_texture_scale;
 	setDoodleJumpCallback([this]()
@@ -310,15 +344,18 @@ OneTimeTile::OneTimeTile():
 		return true;
 	});
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["tiles_one_time"].texture_rect, {64, 20});
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	m_animations->addAnimation("disappear", [](sf::Sprite& sp, float progress)
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
 	{
-		sf::Color col = sp.getColor();
-		col.a = 255 - progress * 255;
-		sp.setColor(col);
-	}, sf::seconds(0.1));
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("tiles_one_time").texture_rect, {64, 20});
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+		animations.addAnimation("disappear", [](sf::Sprite& sp, float progress)
+		{
+			sf::Color col = sp.getColor();
+			col.a = 255 - progress * 255;
+			sp.setColor(col);
+		}, sf::seconds(0.1));
+	}));
 
 	m_animator.play() << thor::Playback::loop("default");
 }
@@ -335,8 +372,8 @@ bool OneTimeTile::isDestroyed() const
 	return m_is_gone;
 }
 
-TeleportTile::TeleportTile() :
-	Tile(&global_sprites["tiles_teleport_0"].getTexture())
+TeleportTile::TeleportTile(RandomEngine& random) :
+	Tile(&global_sprites.at("tiles_teleport_0").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 114, 30 } *m_texture_scale;
 	setDoodleJumpCallback([this]()
@@ -345,23 +382,30 @@ TeleportTile::TeleportTile() :
 		return true;
 	});
 	setScale(m_texture_scale, m_texture_scale);
-	size_t size = thor::Distributions::uniform(10, 15)();
-	auto dur_dist = thor::Distributions::uniform(1, 3);
+	//the frames are random, so every teleport tile has its own animations
+	auto animations = std::make_shared<SpriteAnimationMap>();
+	size_t size = random.uniform(10, 15);
 	thor::FrameAnimation default_animation;
-	for (size_t i = 0; i < size; i++) default_animation.addFrame(dur_dist(), global_sprites[std::string("tiles_teleport_") + char(i + 48)].texture_rect, {64, 20});
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
-	m_animations->addAnimation("disappear", [](sf::Sprite& sp, float progress)
+	for (size_t i = 0; i < size; i++)
+	{
+		//only the first frames have sprites, the others stay empty (find does not add them to global_sprites, so it is safe from many threads)
+		auto sprite = global_sprites.find(std::string("tiles_teleport_") + char(i + 48));
+		default_animation.addFrame(random.uniform(1, 3), sprite != global_sprites.end() ? sprite->second.texture_rect : sf::IntRect{}, {64, 20});
+	}
+	animations->addAnimation("default", default_animation, sf::seconds(1));
+	animations->addAnimation("disappear", [](sf::Sprite& sp, float progress)
 	{
 		sf::Color col = sp.getColor();
 		col.a = 255 - progress * 255;
 		sp.setColor(col);
 	}, sf::seconds(0.1));
-	m_animations->addAnimation("appear", [](sf::Sprite& sp, float progress)
+	animations->addAnimation("appear", [](sf::Sprite& sp, float progress)
 	{
 		sf::Color col = sp.getColor();
 		col.a = progress * 255;
 		sp.setColor(col);
 	}, sf::seconds(0.1));
+	setAnimations(std::move(animations));
 
 	m_animator.play() << thor::Playback::loop("default");
 }
@@ -396,35 +440,14 @@ void TeleportTile::next()
 		<< thor::Playback::loop("default");
 }
 
-void TeleportTile::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void TeleportTile::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
 {
-	sf::Sprite copy{ *this };
-	sf::Vector2f offset = m_offsets[std::min(m_current_offset_index, m_offsets.size() - 1)];
-	copy.setPosition(getPosition() + offset);
-	target.draw(copy, states);
+	batch.add(*this, offset + m_offsets[std::min(m_current_offset_index, m_offsets.size() - 1)]);
 }
 
-std::unordered_map<size_t, std::shared_ptr<std::deque<ClusterTile*>>> ClusterTile::Id::id_tiles_map{};
-
-void ClusterTile::Id::addTile(ClusterTile* tile)
-{
-	if (!is_valid()) return;
-	m_tiles->push_back(tile);
-}
-
-void ClusterTile::Id::removeTile(ClusterTile* tile)
-{
-	if (!is_valid()) return;
-	auto itr = std::find(m_tiles->begin(), m_tiles->end(), tile);
-	if (itr != m_tiles->end()) m_tiles->erase(itr);
-}
-
-ClusterTile::Id::Id(size_t id)
-{
-	if(id) if (!id_tiles_map.contains(id)) id_tiles_map[id] = std::shared_ptr<std::deque<ClusterTile*>>(new std::deque<ClusterTile*>);
-	m_id = id;
-	if(id) m_tiles = id_tiles_map[id];
-}
+ClusterTile::Id::Id(size_t id):
+	m_id(id)
+{}
 
 ClusterTile::Id::Id():
 	Id(0)
@@ -461,101 +484,149 @@ void from_json(const nl::json& j, ClusterTile::Id& id)
 	if (j.contains("id")) id = ClusterTile::Id(j["id"].get<size_t>());
 }
 
-ClusterTile::ClusterTile(Id id):
-	Tile(&global_sprites["tiles_cluster"].getTexture()),
+ClusterTile::Group::Group(Id id):
 	m_id(id)
+{}
+
+void ClusterTile::Group::update(sf::Time dt)
+{
+	m_time += dt;
+	if (m_is_in_transition && m_time - m_transition_start > m_transition_duration) m_is_in_transition = 0;
+}
+
+void ClusterTile::Group::next()
+{
+	m_jumps_count++;
+	m_is_in_transition = true;
+	m_transition_start = m_time;
+}
+
+ClusterTile::Group* ClusterTile::Clusters::get(Id id)
+{
+	if (id.is_valid())
+		if (auto itr = m_groups_by_id.find(id.m_id); itr != m_groups_by_id.end()) return itr->second;
+	Group* group = &m_groups.emplace_back(id);
+	if (id.is_valid()) m_groups_by_id[id.m_id] = group;
+	return group;
+}
+
+void ClusterTile::Clusters::update(sf::Time dt)
+{
+	for (auto itr = m_groups.begin(); itr != m_groups.end();)
+	{
+		if (itr->m_members_count)
+		{
+			itr->update(dt);
+			itr++;
+			continue;
+		}
+		if (itr->m_id.is_valid()) m_groups_by_id.erase(itr->m_id.m_id);
+		itr = m_groups.erase(itr);
+	}
+}
+
+void ClusterTile::Clusters::clear()
+{
+	m_groups_by_id.clear();
+	m_groups.clear();
+}
+
+void ClusterTile::joinGroup(Group* group)
+{
+	m_group = group;
+	if (!m_group) return;
+	m_group->m_members_count++;
+}
+
+void ClusterTile::leaveGroup()
+{
+	if (m_group) m_group->m_members_count--;
+	m_group = nullptr;
+}
+
+ClusterTile::ClusterTile(Id id, Clusters& clusters):
+	Tile(&global_sprites.at("tiles_cluster").getTexture())
 {
 	m_collision_box_size = sf::Vector2f{ 114, 30 } *m_texture_scale;
 	setDoodleJumpCallback([this]()
 	{
-		next();
+		if (m_group) m_group->next();
 		return true;
 	});	
 	setScale(m_texture_scale, m_texture_scale);
-	thor::FrameAnimation default_animation;
-	default_animation.addFrame(1, global_sprites["tiles_cluster"].texture_rect, {64, 20});
-	m_animations->addAnimation("default", default_animation, sf::seconds(1));
+	setAnimations(getSharedAnimations([](SpriteAnimationMap& animations)
+	{
+		thor::FrameAnimation default_animation;
+		default_animation.addFrame(1, global_sprites.at("tiles_cluster").texture_rect, {64, 20});
+		animations.addAnimation("default", default_animation, sf::seconds(1));
+	}));
 	m_animator.play() << thor::Playback::loop("default");
-	m_id.addTile(this);
+	setId(id, clusters);
 }
 
 ClusterTile::ClusterTile(const ClusterTile& oth) :
 	Tile(oth),
 	m_offsets(oth.m_offsets),
-	m_current_offset_index(oth.m_current_offset_index),
 	m_existing_time(oth.m_existing_time),
-	m_transition_start(oth.m_transition_start),
-	m_transition_duration(oth.m_transition_duration),
 	m_oscillating_duration(oth.m_oscillating_duration),
 	m_oscillation_offset(oth.m_oscillation_offset),
-	m_is_in_transition(oth.m_is_in_transition),
-	m_id(oth.m_id)
+	m_first_jump(oth.m_first_jump)
 {
-	m_id.addTile(this);
+	joinGroup(oth.m_group);
 }
 
 ClusterTile::ClusterTile(ClusterTile&& oth) noexcept:
 	Tile(std::move(oth)),
 	m_offsets(std::move(oth.m_offsets)),
-	m_current_offset_index(std::move(oth.m_current_offset_index)),
 	m_existing_time(std::move(oth.m_existing_time)),
-	m_transition_start(std::move(oth.m_transition_start)),
-	m_transition_duration(std::move(oth.m_transition_duration)),
 	m_oscillating_duration(std::move(oth.m_oscillating_duration)),
 	m_oscillation_offset(std::move(oth.m_oscillation_offset)),
-	m_is_in_transition(std::move(oth.m_is_in_transition)),
-	m_id(std::move(oth.m_id))
+	m_first_jump(oth.m_first_jump)
 {
-	m_id.removeTile(&oth);
-	m_id.addTile(this);
+	//the place in the group is taken over
+	m_group = std::exchange(oth.m_group, nullptr);
 }
 
 ClusterTile& ClusterTile::operator=(const ClusterTile& oth)
 {
-	m_id.removeTile(this);
+	if (this == &oth) return *this;
+	leaveGroup();
 	this->Tile::operator=(oth);
 	m_offsets = oth.m_offsets;
-	m_current_offset_index = oth.m_current_offset_index;
 	m_existing_time = oth.m_existing_time;
-	m_transition_start = oth.m_transition_start;
-	m_transition_duration = oth.m_transition_duration;
 	m_oscillating_duration = oth.m_oscillating_duration;
 	m_oscillation_offset = oth.m_oscillation_offset;
-	m_is_in_transition = oth.m_is_in_transition;
-	m_id = oth.m_id;
-	m_id.addTile(this);
+	m_first_jump = oth.m_first_jump;
+	joinGroup(oth.m_group);
 	return *this;
 }
 
 ClusterTile& ClusterTile::operator=(ClusterTile&& oth) noexcept
 {
-	m_id.removeTile(this);
+	if (this == &oth) return *this;
+	leaveGroup();
 	this->Tile::operator=(std::move(oth));
 	m_offsets = std::move(oth.m_offsets);
-	m_current_offset_index = std::move(oth.m_current_offset_index);
 	m_existing_time = std::move(oth.m_existing_time);
-	m_transition_start = std::move(oth.m_transition_start);
-	m_transition_duration = std::move(oth.m_transition_duration);
 	m_oscillating_duration = std::move(oth.m_oscillating_duration);
 	m_oscillation_offset = std::move(oth.m_oscillation_offset);
-	m_is_in_transition = std::move(oth.m_is_in_transition);
-	m_id = std::move(oth.m_id);
-	m_id.removeTile(&oth);
-	m_id.addTile(this);
+	m_first_jump = oth.m_first_jump;
+	m_group = std::exchange(oth.m_group, nullptr);
 	return *this;
 }
 
-void ClusterTile::setId(Id id)
+void ClusterTile::setId(Id id, Clusters& clusters)
 {
-	m_id.removeTile(this);
-	m_id = id;
-	m_id.addTile(this);
+	//the tile keeps its current offset in the new group
+	size_t jumps_count = m_group ? m_group->m_jumps_count - m_first_jump : 0;
+	leaveGroup();
+	joinGroup(clusters.get(id));
+	m_first_jump = m_group->m_jumps_count - jumps_count;
 }
 
 void ClusterTile::update(sf::Time dt)
 {
 	m_existing_time += dt;
-	if (m_is_in_transition && m_existing_time - m_transition_start > m_transition_duration) m_is_in_transition = 0;
 	m_collision_box = sf::FloatRect(getPosition() - m_collision_box_size / 2.f + getCurrentOffset(), m_collision_box_size);
 	m_animator.update(dt);
 	m_animator.animate(*this);
@@ -568,7 +639,7 @@ void ClusterTile::addNewPosition(sf::Vector2f offset_from_first_position)
 
 ClusterTile::~ClusterTile()
 {
-	m_id.removeTile(this);
+	leaveGroup();
 }
 
 sf::Vector2f ClusterTile::m_interpolation(sf::Vector2f start, sf::Vector2f end, float progress)
@@ -578,65 +649,97 @@ sf::Vector2f ClusterTile::m_interpolation(sf::Vector2f start, sf::Vector2f end,
 
 sf::Vector2f ClusterTile::getCurrentOffset() const
 {
+	//a tile without a group (it was moved from) stays at its first offset, the moved-from one has no offsets at all
+	if (!m_group) return m_offsets.empty() ? sf::Vector2f{} : m_offsets[0];
+	size_t jumps_count = m_group->m_jumps_count - m_first_jump;
+	size_t current_offset_index = jumps_count % m_offsets.size();
 	sf::Vector2f offset;
-	if (!m_is_in_transition) offset = m_offsets[m_current_offset_index];
+	//a tile that joined during a transition is not in it
+	if (!m_group->m_is_in_transition || !jumps_count) offset = m_offsets[current_offset_index];
 	else
 	{
-		sf::Vector2f m_prev_offset = m_offsets[(m_current_offset_index - 1 + m_offsets.size()) % m_offsets.size()];
-		sf::Vector2f m_curr_offset = m_offsets[m_current_offset_index];
-		offset = m_interpolation(m_prev_offset, m_curr_offset, (m_existing_time - m_transition_start) / m_transition_duration);
+		sf::Vector2f m_prev_offset = m_offsets[(current_offset_index - 1 + m_offsets.size()) % m_offsets.size()];
+		sf::Vector2f m_curr_offset = m_offsets[current_offset_index];
+		offset = m_interpolation(m_prev_offset, m_curr_offset, (m_group->m_time - m_group->m_transition_start) / m_group->m_transition_duration);
 	}
 
 	return offset + m_oscillation_offset * std::sin(m_existing_time / m_oscillating_duration * thor::TrigonometricTraits<float>::pi() * 2);
 }
 
-void ClusterTile::next(bool recursive)
+void ClusterTile::addToBatch(SpriteBatch& batch, sf::Vector2f offset) const
 {
-	m_current_offset_index++;
-	m_current_offset_index %= m_offsets.size();
-	m_is_in_transition = true;
-	m_transition_start = m_existing_time;
-	if(recursive) for (auto tile : (*m_id.m_tiles)) if(tile != this) tile->next(0);
+	batch.add(*this, offset + getCurrentOffset());
 }
 
-void ClusterTile::draw(sf::RenderTarget& target, sf::RenderStates states) const
+Tiles::Tiles(const Camera& camera):
+	m_camera(camera)
 {
-	sf::Sprite copy{ *this };
-	copy.setPosition(getPosition() + getCurrentOffset());
-	target.draw(copy, states);
 }
 
-Tiles::Tiles(sf::RenderWindow& game_window):
-	m_game_window(game_window)
+void Tiles::add(Tile* tile)
 {
+	m_tiles.emplace_back(tile);
+	//not interpolated from the origin until its first update
+	tile->m_previous_position = tile->getPosition();
+	tile->m_order = m_next_order++;
+	tile->m_top_bucket = 1;
+	tile->m_bottom_bucket = 0;
+	index(tile);
+}
+
+void Tiles::clear()
+{
+	m_tiles.clear();
+	m_buckets.clear();
+	m_clusters.clear();
 }
 
 void Tiles::update(sf::Time dt)
 {
+	PROFILE_SCOPE("Tiles::update");
+	sf::FloatRect area = m_camera.getSnapshot().view_area;
+	m_clusters.update(dt);
 	for (auto& tile : m_tiles)
 	{
+		tile->m_previous_position = tile->getPosition();
 		tile->update(dt);
-		if (sf::FloatRect area = utils::getViewArea(m_game_window); tile->getCollisionBox().top > area.top + area.height)
+		index(tile.get());
+		if (tile->getCollisionBox().top > area.top + area.height)
 			tile->m_is_fallen_off_screen = true;
 	}
 
-	for (size_t i = 0; i < m_tiles.size(); i++)
-		if (sf::FloatRect area = utils::getViewArea(m_game_window); m_tiles[i]->isDestroyed() || m_tiles[i]->getCollisionBox().top > area.top + area.height)
-			if(m_tiles[i]->isReadyToBeDeleted())
-				m_tiles.erase(m_tiles.begin() + i--);
+	//one stable compaction for all the removed tiles, not an erase in the middle of the deque for every one of them
+	std::erase_if(m_tiles, [&](const std::unique_ptr<Tile>& tile)
+	{
+		if (!(tile->isDestroyed() || tile->getCollisionBox().top > area.top + area.height) || !tile->isReadyToBeDeleted()) return false;
+		unindex(tile.get());
+		return true;
+	});
 }
 
-Tile* Tiles::getTileDoodleWillJump(sf::FloatRect doodle_feet)
+void Tiles::setInterpolationAlpha(float alpha)
 {
-	Tile* res_tile{ nullptr };
-	sf::FloatRect feet{ doodle_feet.left, doodle_feet.top + doodle_feet.height - 1, doodle_feet.width, 1 };
-	for (const auto& tile : m_tiles) if(tile->canCollide()) if (tile->getCollisionBox().intersects(feet)) res_tile = (tile->m_on_doodle_jump() ? tile.get() : nullptr);
-	return res_tile;
+	m_interpolation_alpha = alpha;
 }
 
-bool Tiles::willDoodleJump(sf::FloatRect doodle_feet)
+Landing<Tile> Tiles::getTileDoodleWillJump(sf::FloatRect doodle_feet, sf::Vector2f displacement)
 {
-	return getTileDoodleWillJump(doodle_feet);
+	//only the tiles in the buckets the bottom line of the feet swept through can be hit
+	m_candidates.clear();
+	float feet_bottom = doodle_feet.top + doodle_feet.height;
+	float top = std::min(feet_bottom, feet_bottom - displacement.y) - 1, bottom = std::max(feet_bottom, feet_bottom - displacement.y);
+	for (int bucket = getBucket(top), bottom_bucket = getBucket(bottom); bucket <= bottom_bucket; bucket++)
+		if (auto itr = m_buckets.find(bucket); itr != m_buckets.end()) m_candidates.insert(m_candidates.end(), itr->second.begin(), itr->second.end());
+	std::sort(m_candidates.begin(), m_candidates.end(), [](const Tile* a, const Tile* b) { return a->m_order < b->m_order; });
+	m_candidates.erase(std::unique(m_candidates.begin(), m_candidates.end()), m_candidates.end());
+	std::erase_if(m_candidates, [](const Tile* tile) { return !tile->canCollide(); });
+
+	return findLanding(doodle_feet, displacement, m_candidates, m_hits, [](Tile* tile, sf::FloatRect) { return tile->m_on_doodle_jump(); });
+}
+
+ClusterTile::Clusters& Tiles::getClusters()
+{
+	return m_clusters;
 }
 
 size_t Tiles::getTilesCount()
@@ -644,11 +747,42 @@ size_t Tiles::getTilesCount()
 	return m_tiles.size();
 }
 
+int Tiles::getBucket(float y) const
+{
+	return int(std::floor(y / m_bucket_height));
+}
+
+void Tiles::index(Tile* tile)
+{
+	sf::FloatRect box = tile->getCollisionBox();
+	int top_bucket = getBucket(box.top), bottom_bucket = getBucket(box.top + box.height);
+	if (top_bucket == tile->m_top_bucket && bottom_bucket == tile->m_bottom_bucket) return;
+
+	unindex(tile);
+	for (int bucket = top_bucket; bucket <= bottom_bucket; bucket++) m_buckets[bucket].push_back(tile);
+	tile->m_top_bucket = top_bucket;
+	tile->m_bottom_bucket = bottom_bucket;
+}
+
+void Tiles::unindex(Tile* tile)
+{
+	for (int bucket = tile->m_top_bucket; bucket <= tile->m_bottom_bucket; bucket++)
+	{
+		auto itr = m_buckets.find(bucket);
+		if (itr == m_buckets.end()) continue;
+		std::erase(itr->second, tile);
+		if (itr->second.empty()) m_buckets.erase(itr);
+	}
+	tile->m_top_bucket = 1;
+	tile->m_bottom_bucket = 0;
+}
+
 void Tiles::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+	SpriteBatch batch(target, states);
 	for (const auto& tile : m_tiles)
 	{
-		target.draw(*tile, states);/*
+		tile->addToBatch(batch, utils::getInterpolationOffset(tile->m_previous_position, tile->getPosition(), m_interpolation_alpha));/*
 		sf::RectangleShape sh{ {tile->getCollisionBox().width, tile->getCollisionBox().height} };
 		sh.setPosition(tile->getCollisionBox().left, tile->getCollisionBox().top);
 		sh.setFillColor(sf::Color(255, 0, 0, 100));
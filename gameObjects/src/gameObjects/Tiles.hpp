@@ -1,20 +1,32 @@
 #pragma once
 #include <string>
 #include <deque>
+#include <list>
+#include <vector>
 #include <unordered_map>
+#include <memory>
+#include <atomic>
 #include <functional>
 
 #include <SFML/Graphics.hpp>
 #include <Thor/Animations.hpp>
 #include <nlohmann/json.hpp>
 
+#include <common/Camera.hpp>
+#include <common/InplaceFunction.hpp>
+#include <common/ObjectPool.hpp>
+#include <common/Random.hpp>
+#include <common/SharedAnimations.hpp>
+#include <common/SpriteBatch.hpp>
+#include <gameObjects/Landing.hpp>
+
 class Tiles;
 class Tile : public sf::Sprite
 {
 public:
 
-	using SpecUpdateFunctionType = std::function<void(sf::Time)>;
-	using OnDoodleJumpFunctionType = std::function<bool()>;
+	using SpecUpdateFunctionType = InplaceFunction<void(sf::Time)>;
+	using OnDoodleJumpFunctionType = InplaceFunction<bool()>;
 
 	Tile();
 	Tile(sf::Texture* texture_ptr);
@@ -37,7 +49,9 @@ public:
 	virtual ~Tile() = default;
 
 protected:
-	std::shared_ptr<thor::AnimationMap<sf::Sprite, std::string>> m_animations;
+	void setAnimations(std::shared_ptr<const SpriteAnimationMap> animations);
+
+	std::shared_ptr<const SpriteAnimationMap> m_animations;
 	thor::Animator<sf::Sprite, std::string> m_animator;
 	sf::FloatRect m_collision_box{};
 	sf::Vector2f m_collision_box_size{};
@@ -48,13 +62,20 @@ protected:
 
 private:
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	//the sprites are added to the batch of the container, the drawable draw makes a batch for one object
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 	bool m_is_ready_to_be_deleted{ 1 };
 	bool m_is_fallen_off_screen{ 0 };
+	sf::Vector2f m_previous_position{};
+	//the place of the tile in the height index of Tiles (the buckets from top to bottom, none if top > bottom) and in the order of the tiles
+	int m_top_bucket{ 1 }, m_bottom_bucket{ 0 };
+	size_t m_order{};
 
 	friend class Tiles;
+	friend class CollisionWorld;
 };
 
-class NormalTile : public Tile
+class NormalTile : public Tile, public Pooled<NormalTile>
 {
 public:
 	NormalTile();
@@ -62,7 +83,7 @@ public:
 	void update(sf::Time dt) override;
 };
 
-class HorizontalSlidingTile: public Tile
+class HorizontalSlidingTile : public Tile, public Pooled<HorizontalSlidingTile>
 {
 	float m_speed;
 	float m_left{0}, m_right{-1};
@@ -75,7 +96,7 @@ public:
 	
 };
 
-class VerticalSlidingTile : public Tile
+class VerticalSlidingTile : public Tile, public Pooled<VerticalSlidingTile>
 {
 	float m_speed;
 	float m_top{0}, m_bottom{-1};
@@ -88,7 +109,7 @@ public:
 	void updateMovingLocation(float top, float bottom);
 };
 
-class DecayedTile : public Tile
+class DecayedTile : public Tile, public Pooled<DecayedTile>
 {
 	float m_speed, m_vert_speed{0}, m_gravity{500};
 	float m_left{ 0 }, m_right{ -1 };
@@ -104,7 +125,7 @@ public:
 	void updateMovingLocation(float left, float right);
 };
 
-class BombTile : public Tile
+class BombTile : public Tile, public Pooled<BombTile>
 {
 	bool m_is_started_exploding{ 0 }, m_is_exploded{ 0 }, m_is_gone{ 0 };
 	float m_exploding_height, m_current_height{};
@@ -114,14 +135,14 @@ public:
 	 
 	void update(sf::Time dt) override;
 	void updateHeight(float current_height);
-	void updateHeight(sf::RenderWindow& window);
+	void updateHeight(const Camera& camera);
 	bool isDestroyed() const override;
 private:
 	void startExploding();
 
 };
 
-class OneTimeTile : public Tile
+class OneTimeTile : public Tile, public Pooled<OneTimeTile>
 {
 	bool m_is_gone{ 0 };
 
@@ -132,14 +153,14 @@ public:
 	bool isDestroyed() const override;
 };
 
-class TeleportTile : public Tile
+class TeleportTile : public Tile, public Pooled<TeleportTile>
 {
 	
 	std::deque<sf::Vector2f> m_offsets{ {0, 0} };
 	size_t m_current_offset_index{ 0 };
 
 public:
-	TeleportTile();
+	TeleportTile(RandomEngine& random);
 
 	void update(sf::Time dt) override;
 	bool isDestroyed() const override;
@@ -148,26 +169,20 @@ public:
 
 private:
 	void next();
-	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 };
 
-class ClusterTile : public Tile
+class ClusterTile : public Tile, public Pooled<ClusterTile>
 {
 	std::deque<sf::Vector2f> m_offsets{ {0, 0} };
-	size_t m_current_offset_index{ 0 };
-	sf::Time m_existing_time{}, m_transition_start{}, m_transition_duration{sf::seconds(0.2)}, m_oscillating_duration{sf::seconds(0.3)};
+	sf::Time m_existing_time{}, m_oscillating_duration{sf::seconds(0.3)};
 	sf::Vector2f m_oscillation_offset{ 10 * m_texture_scale, 0 };
-	bool m_is_in_transition{ 0 };
 public:
 
 	class Id
 	{
 		size_t m_id;
-		std::shared_ptr<std::deque<ClusterTile*>> m_tiles{};
-		void addTile(ClusterTile* tile);
-		void removeTile(ClusterTile* tile);
-		inline static size_t counter{ 0 };
-		static std::unordered_map<size_t, std::shared_ptr<std::deque<ClusterTile*>>> id_tiles_map;
+		inline static std::atomic<size_t> counter{ 0 };
 		Id(size_t id);
 	public:
 		Id();
@@ -178,17 +193,50 @@ public:
 		friend void from_json(const nl::json& j, Id& id);
 		friend class ClusterTile;
 	};
+
+	//the tiles of one cluster, a jump on any of them moves all of them to their next offsets
+	//the group keeps the count of the jumps and the clock of the transition, so a jump only changes the group and the tiles read it
+	class Group
+	{
+		Id m_id{};
+		size_t m_members_count{ 0 }, m_jumps_count{ 0 };
+		sf::Time m_time{}, m_transition_start{}, m_transition_duration{ sf::seconds(0.2) };
+		bool m_is_in_transition{ 0 };
+	public:
+		Group(Id id);
+		void update(sf::Time dt);
+		void next();
+		friend class ClusterTile;
+	};
+
+	//the groups of the clusters of one Tiles (so the clusters of different levels are separate)
+	//the tiles without an id get a group of their own
+	class Clusters
+	{
+		std::list<Group> m_groups{};
+		std::unordered_map<size_t, Group*> m_groups_by_id{};
+	public:
+		Group* get(Id id);
+		//advances the clocks of the groups and forgets the groups that have no tiles anymore
+		void update(sf::Time dt);
+		void clear();
+	};
+
 private:
-	Id m_id;
+	Group* m_group{ nullptr };
+	//the jumps of the group before this tile joined it, this tile is moved only by the later ones
+	size_t m_first_jump{ 0 };
+	void joinGroup(Group* group);
+	void leaveGroup();
 
 public:
-	ClusterTile(Id id);
+	ClusterTile(Id id, Clusters& clusters);
 	ClusterTile(const ClusterTile& oth);
 	ClusterTile(ClusterTile&& oth) noexcept;
 	ClusterTile& operator=(const ClusterTile& oth);
 	ClusterTile& operator=(ClusterTile&& oth) noexcept;
 
-	void setId(Id id);
+	void setId(Id id, Clusters& clusters);
 	void update(sf::Time dt) override;
 	void addNewPosition(sf::Vector2f offset_from_first_position);
 	~ClusterTile();
@@ -196,8 +244,7 @@ public:
 private:
 	static sf::Vector2f m_interpolation(sf::Vector2f start, sf::Vector2f end, float progress);
 	sf::Vector2f getCurrentOffset() const;
-	void next(bool recursive = 1);
-	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	virtual void addToBatch(SpriteBatch& batch, sf::Vector2f offset) const;
 
 };
 
@@ -206,19 +253,39 @@ class LevelGenerator;
 class Tiles : public sf::Drawable
 {
 private:
+	//the groups are destroyed after the tiles that are in them
+	ClusterTile::Clusters m_clusters{};
 	std::deque<std::unique_ptr<Tile>> m_tiles;
-	sf::RenderWindow& m_game_window;
+	const Camera& m_camera;
+	float m_interpolation_alpha{ 1 };
+
+	//the tiles are indexed by the height of their collision boxes, in buckets of m_bucket_height
+	//a tile is reindexed after its update (the collision boxes change only there), so the moving tiles stay in the right buckets
+	float m_bucket_height{ 64 };
+	std::unordered_map<int, std::vector<Tile*>> m_buckets{};
+	size_t m_next_order{ 0 };
+	std::vector<Tile*> m_candidates{};
+	std::vector<std::pair<float, Tile*>> m_hits{};
 
 public:
-	Tiles(sf::RenderWindow& game_window);
+	Tiles(const Camera& camera);
+	void add(Tile* tile);
+	void clear();
 	void update(sf::Time dt);
-	Tile* getTileDoodleWillJump(sf::FloatRect doodle_feet);
-	bool willDoodleJump(sf::FloatRect doodle_feet);
+	void setInterpolationAlpha(float alpha);
+	//the feet are swept by the displacement (how they moved in the last update), so the tiles they passed through are not missed
+	Landing<Tile> getTileDoodleWillJump(sf::FloatRect doodle_feet, sf::Vector2f displacement = {});
 	size_t getTilesCount();
+	ClusterTile::Clusters& getClusters();
 
 private:
+	int getBucket(float y) const;
+	void index(Tile* tile);
+	void unindex(Tile* tile);
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 	friend class Level;
 	friend class LevelGenerator;
+	friend class InputBot;
+	friend class CollisionWorld;
 
 };
\ No newline at end of file
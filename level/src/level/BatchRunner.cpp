@@ -0,0 +1,76 @@
+#include "BatchRunner.hpp"
+
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <algorithm>
+
+#include <level/Level.hpp>
+#include <level/InputBot.hpp>
+
+BatchRunner::BatchRunner(Settings settings) :
+	m_settings(std::move(settings))
+{
+	std::ifstream fin(m_settings.level_path);
+	if (fin) fin >> m_level_json;
+}
+
+std::vector<BatchRunner::SeedStatistics> BatchRunner::run(const std::vector<uint64_t>& seeds) const
+{
+	std::vector<SeedStatistics> statistics(seeds.size());
+	size_t threads_count = m_settings.threads_count ? m_settings.threads_count : std::max(1u, std::thread::hardware_concurrency());
+	threads_count = std::min(threads_count, seeds.size());
+
+	//the workers take the next seed until there are none left, so a slow seed does not hold back the others
+	std::atomic<size_t> next_seed_index{ 0 };
+	std::vector<std::exception_ptr> exceptions(threads_count);
+	{
+		std::vector<std::jthread> workers;
+		workers.reserve(threads_count);
+		for (size_t i = 0; i < threads_count; i++) workers.emplace_back([&, i]()
+		{
+			try
+			{
+				for (size_t index = next_seed_index++; index < seeds.size(); index = next_seed_index++)
+					statistics[index] = runSeed(seeds[index]);
+			}
+			catch (...)
+			{
+				exceptions[i] = std::current_exception();
+			}
+		});
+	}
+	for (auto& exception : exceptions) if (exception) std::rethrow_exception(exception);
+
+	return statistics;
+}
+
+BatchRunner::SeedStatistics BatchRunner::runSeed(uint64_t seed) const
+{
+	auto start = std::chrono::steady_clock::now();
+
+	Level level(m_settings.view_size);
+	if (!m_level_json.is_null()) m_level_json.get_to(level);
+	level.level_generator.setSeed(seed);
+	level.refresh();
+	InputBot bot;
+
+	SeedStatistics statistics{ .seed = seed };
+	float start_y = level.camera.getView().getCenter().y;
+	bool was_dead = level.doodle.isDead();
+	for (size_t i = 0; i < m_settings.ticks_count; i++)
+	{
+		level.applyInput(bot.getInput(level, m_settings.tick_time), m_settings.tick_time);
+		level.update(m_settings.tick_time);
+
+		if (!was_dead && level.doodle.isDead()) statistics.deaths_count++;
+		was_dead = level.doodle.isDead();
+		statistics.max_height = std::max(statistics.max_height, start_y - level.camera.getView().getCenter().y);
+		statistics.max_tiles_count = std::max(statistics.max_tiles_count, level.tiles.getTilesCount());
+	}
+
+	statistics.real_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return statistics;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <SFML/Graphics.hpp>
+#include <nlohmann/json.hpp>
+
+//runs a level with many seeds at the same time, every seed on its own headless level played by an InputBot
+//the levels share nothing but the resources, so init_resources must be called before running
+class BatchRunner
+{
+public:
+	struct Settings
+	{
+		std::string level_path{};
+		sf::Vector2u view_size{ 500, 800 };
+		sf::Time tick_time{ sf::seconds(1.f / 120) };
+		size_t ticks_count{ 36000 };
+		size_t threads_count{ 0 }; // 0 for one thread per core
+	};
+
+	struct SeedStatistics
+	{
+		uint64_t seed{};
+		float max_height{}; // how high the view scrolled
+		size_t deaths_count{};
+		size_t max_tiles_count{};
+		double real_time{}; // in seconds
+	};
+
+	BatchRunner(Settings settings);
+
+	//the statistics are in the order of the seeds
+	std::vector<SeedStatistics> run(const std::vector<uint64_t>& seeds) const;
+	SeedStatistics runSeed(uint64_t seed) const;
+
+private:
+	Settings m_settings;
+	nl::json m_level_json{};
+};
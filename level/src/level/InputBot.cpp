@@ -0,0 +1,61 @@
+#include "InputBot.hpp"
+
+#include <level/Level.hpp>
+
+TickInput InputBot::getInput(const Level& level, sf::Time dt)
+{
+	TickInput input;
+	const Doodle& doodle = level.doodle;
+
+	if (doodle.isDead())
+	{
+		m_time_since_death += dt;
+		if (m_time_since_death >= m_ressurecting_delay)
+		{
+			m_time_since_death = sf::Time::Zero;
+			input.ressurect_position = level.camera.getView().getCenter();
+		}
+		return input;
+	}
+	m_time_since_death = sf::Time::Zero;
+
+	m_time_since_shooting += dt;
+	if (m_time_since_shooting >= m_shooting_interval && doodle.canShoot())
+	{
+		m_time_since_shooting = sf::Time::Zero;
+		input.shoot_angle = 0;
+	}
+
+	//the target is the highest tile in the view, that is below the feet or not higher than the current jump goes
+	sf::FloatRect feet = doodle.getFeetCollisionBox();
+	float feet_bottom = feet.top + feet.height;
+	float velocity = doodle.getVelocity().y, gravity = doodle.getGravity().y;
+	float highest_reachable = feet_bottom - (velocity < 0 && gravity > 0 ? velocity * velocity / (2 * gravity) : 0);
+	sf::FloatRect view_area = level.camera.getViewArea();
+
+	const Tile* target = nullptr;
+	for (const auto& tile : level.tiles.m_tiles)
+	{
+		if (!tile->canCollide()) continue;
+		float top = tile->getCollisionBox().top;
+		if (top < highest_reachable || top > view_area.top + view_area.height) continue;
+		if (!target || top < target->getCollisionBox().top) target = tile.get();
+	}
+	if (!target) return input;
+
+	sf::FloatRect target_box = target->getCollisionBox();
+	float offset = (target_box.left + target_box.width / 2) - (feet.left + feet.width / 2);
+	if (offset < -m_dead_zone) input.left = true;
+	else if (offset > m_dead_zone) input.right = true;
+	return input;
+}
+
+void InputBot::setShootingInterval(sf::Time interval)
+{
+	m_shooting_interval = interval;
+}
+
+void InputBot::setRessurectingDelay(sf::Time delay)
+{
+	m_ressurecting_delay = delay;
+}
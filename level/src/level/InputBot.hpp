@@ -0,0 +1,21 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+#include <level/InputRecording.hpp>
+
+//plays the level instead of the user (for the benchmarks), it is deterministic, so its runs are reproducible too
+//it moves towards the highest tile it can land on, shoots up from time to time and ressurects the doodle after it dies
+struct Level;
+class InputBot
+{
+public:
+	TickInput getInput(const Level& level, sf::Time dt);
+
+	void setShootingInterval(sf::Time interval);
+	void setRessurectingDelay(sf::Time delay);
+
+private:
+	sf::Time m_shooting_interval{ sf::seconds(1) }, m_ressurecting_delay{ sf::seconds(1) };
+	sf::Time m_time_since_shooting{}, m_time_since_death{};
+	float m_dead_zone{ 10 };
+};
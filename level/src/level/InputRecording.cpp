@@ -0,0 +1,213 @@
+#include "InputRecording.hpp"
+
+#include <fstream>
+#include <algorithm>
+#include <type_traits>
+
+#include <level/Level.hpp>
+
+//file layout (little endian):
+//magic, version, seed, target size, view size, tick time in microseconds, level json, ticks count, then the ticks as records:
+//a flags byte, then either the payloads of the one time actions (such a record is one tick) or the length of the run of equal ticks
+
+constexpr char recording_magic[4]{ 'D', 'J', 'I', 'R' };
+constexpr uint16_t recording_version = 2;
+
+enum TickInputFlags : uint8_t
+{
+	Left = 1 << 0,
+	Right = 1 << 1,
+	Shoot = 1 << 2,
+	Die = 1 << 3,
+	Ressurect = 1 << 4,
+	OneTimeActions = Shoot | Die | Ressurect
+};
+
+template<class T> requires std::is_trivially_copyable_v<T>
+void writeBinary(std::ostream& out, const T& value)
+{
+	out.write((const char*)&value, sizeof(T));
+}
+
+template<class T> requires std::is_trivially_copyable_v<T>
+T readBinary(std::istream& in)
+{
+	T value{};
+	in.read((char*)&value, sizeof(T));
+	return value;
+}
+
+void writeVarint(std::ostream& out, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		out.put(char((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+	out.put(char(value));
+}
+
+uint64_t readVarint(std::istream& in)
+{
+	uint64_t value = 0;
+	for (int shift = 0; shift < 64 && in; shift += 7)
+	{
+		uint8_t byte = (uint8_t)in.get();
+		value |= uint64_t(byte & 0x7f) << shift;
+		if (!(byte & 0x80)) break;
+	}
+	return value;
+}
+
+uint8_t getFlags(const TickInput& input)
+{
+	return (input.left ? Left : 0) | (input.right ? Right : 0) | (input.shoot_angle ? Shoot : 0) | (input.die_position ? Die : 0) | (input.ressurect_position ? Ressurect : 0);
+}
+
+bool InputRecording::saveToFile(const std::string& path) const
+{
+	std::ofstream fout(path, std::ios::binary);
+	if (!fout) return false;
+
+	fout.write(recording_magic, sizeof(recording_magic));
+	writeBinary(fout, recording_version);
+	writeBinary(fout, seed);
+	writeBinary(fout, target_size.x);
+	writeBinary(fout, target_size.y);
+	writeBinary(fout, view_size.x);
+	writeBinary(fout, view_size.y);
+	writeBinary(fout, tick_time.asMicroseconds());
+	writeVarint(fout, level_json.size());
+	fout.write(level_json.data(), level_json.size());
+	writeVarint(fout, ticks.size());
+
+	for (size_t i = 0; i < ticks.size();)
+	{
+		uint8_t flags = getFlags(ticks[i]);
+		writeBinary(fout, flags);
+		if (flags & OneTimeActions)
+		{
+			if (ticks[i].shoot_angle) writeBinary(fout, *ticks[i].shoot_angle);
+			if (ticks[i].die_position) writeBinary(fout, *ticks[i].die_position);
+			if (ticks[i].ressurect_position) writeBinary(fout, *ticks[i].ressurect_position);
+			i++;
+			continue;
+		}
+		size_t run_end = i + 1;
+		while (run_end < ticks.size() && ticks[run_end] == ticks[i]) run_end++;
+		writeVarint(fout, run_end - i);
+		i = run_end;
+	}
+	return bool(fout);
+}
+
+bool InputRecording::loadFromFile(const std::string& path)
+{
+	std::ifstream fin(path, std::ios::binary);
+	if (!fin) return false;
+
+	char magic[sizeof(recording_magic)]{};
+	fin.read(magic, sizeof(magic));
+	if (!std::equal(std::begin(magic), std::end(magic), std::begin(recording_magic))) return false;
+	if (readBinary<uint16_t>(fin) != recording_version) return false;
+
+	InputRecording recording;
+	recording.seed = readBinary<uint64_t>(fin);
+	recording.target_size.x = readBinary<unsigned int>(fin);
+	recording.target_size.y = readBinary<unsigned int>(fin);
+	recording.view_size.x = readBinary<float>(fin);
+	recording.view_size.y = readBinary<float>(fin);
+	recording.tick_time = sf::microseconds(readBinary<sf::Int64>(fin));
+	recording.level_json.resize(readVarint(fin));
+	fin.read(recording.level_json.data(), recording.level_json.size());
+	size_t ticks_count = readVarint(fin);
+	recording.ticks.reserve(ticks_count);
+
+	while (recording.ticks.size() < ticks_count && fin)
+	{
+		uint8_t flags = readBinary<uint8_t>(fin);
+		TickInput input;
+		input.left = flags & Left;
+		input.right = flags & Right;
+		if (flags & OneTimeActions)
+		{
+			if (flags & Shoot) input.shoot_angle = readBinary<float>(fin);
+			if (flags & Die) input.die_position = readBinary<sf::Vector2f>(fin);
+			if (flags & Ressurect) input.ressurect_position = readBinary<sf::Vector2f>(fin);
+			recording.ticks.push_back(input);
+			continue;
+		}
+		size_t run = std::min<size_t>(readVarint(fin), ticks_count - recording.ticks.size());
+		recording.ticks.insert(recording.ticks.end(), run, input);
+	}
+	if (!fin || recording.ticks.size() != ticks_count) return false;
+
+	*this = std::move(recording);
+	return true;
+}
+
+void InputRecorder::start(Level& level, sf::Time tick_time)
+{
+	level.refresh();
+	m_recording = InputRecording{};
+	m_recording.level_json = nl::json(level).dump();
+	m_recording.seed = level.level_generator.getCurrentSeed();
+	m_recording.target_size = level.camera.getSize();
+	m_recording.view_size = level.camera.getView().getSize();
+	m_recording.tick_time = tick_time;
+	m_is_recording = true;
+}
+
+void InputRecorder::record(const TickInput& input)
+{
+	if (m_is_recording) m_recording.ticks.push_back(input);
+}
+
+void InputRecorder::stop()
+{
+	m_is_recording = false;
+}
+
+bool InputRecorder::isRecording() const
+{
+	return m_is_recording;
+}
+
+const InputRecording& InputRecorder::getRecording() const
+{
+	return m_recording;
+}
+
+InputReplay::InputReplay(Level& level, const InputRecording& recording) :
+	m_level(level),
+	m_recording(recording)
+{}
+
+void InputReplay::start()
+{
+	nl::json::parse(m_recording.level_json).get_to(m_level);
+	m_level.level_generator.setSeed(m_recording.seed);
+	//the scene divides its view size by the zoom, the refresh applies it to the camera
+	sf::Vector2f view_size = m_level.camera.getView().getSize();
+	m_level.scene.zoom({ view_size.x / m_recording.view_size.x, view_size.y / m_recording.view_size.y }, true);
+	m_level.refresh();
+	m_current_tick = 0;
+}
+
+bool InputReplay::step()
+{
+	if (isFinished()) return false;
+	m_level.applyInput(m_recording.ticks[m_current_tick++], m_recording.tick_time);
+	m_level.update(m_recording.tick_time);
+	return true;
+}
+
+size_t InputReplay::getCurrentTick() const
+{
+	return m_current_tick;
+}
+
+bool InputReplay::isFinished() const
+{
+	return m_current_tick >= m_recording.ticks.size();
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <optional>
+
+#include <SFML/Graphics.hpp>
+
+//the input of one tick, already resolved from the actions and the mouse (the positions are in level coordinates)
+struct TickInput
+{
+	bool left{ false }, right{ false };
+	std::optional<float> shoot_angle{};
+	std::optional<sf::Vector2f> die_position{};
+	std::optional<sf::Vector2f> ressurect_position{};
+
+	bool operator==(const TickInput& oth) const = default;
+};
+
+//everything needed to play a run again: the level, its seed, the target and view sizes, the tick time and the input of every tick
+//the view size is in level coordinates (the target size with the zoom of the scene), the generation and the wrapping depend on it
+struct InputRecording
+{
+	std::string level_json{};
+	uint64_t seed{};
+	sf::Vector2u target_size{};
+	sf::Vector2f view_size{};
+	sf::Time tick_time{};
+	std::vector<TickInput> ticks{};
+
+	//the file is binary, the runs of equal ticks without one time actions are stored once with their length
+	bool saveToFile(const std::string& path) const;
+	bool loadFromFile(const std::string& path);
+};
+
+struct Level;
+class InputRecorder
+{
+public:
+	//refreshes the level and starts recording from there
+	void start(Level& level, sf::Time tick_time);
+	void record(const TickInput& input);
+	void stop();
+	bool isRecording() const;
+	const InputRecording& getRecording() const;
+
+private:
+	InputRecording m_recording{};
+	bool m_is_recording{ false };
+};
+
+//feeds a recording back into a level, tick by tick (the level does not need a window)
+class InputReplay
+{
+public:
+	InputReplay(Level& level, const InputRecording& recording);
+
+	//loads the recorded level, seed and view size and refreshes the level
+	void start();
+	//simulates one tick, returns false if the recording has ended
+	bool step();
+	size_t getCurrentTick() const;
+	bool isFinished() const;
+
+private:
+	Level& m_level;
+	const InputRecording& m_recording;
+	size_t m_current_tick{ 0 };
+};
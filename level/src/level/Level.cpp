@@ -1,84 +1,135 @@
 #include "Level.hpp"
 
 #include <fstream>
+#include <chrono>
 #include <common/Resources.hpp>
 #include <common/Utils.hpp>
-#include <common/Previews.hpp>
+#include <common/Profiler.hpp>
 #include <DoodleJumpConfig.hpp>
 
 Level::Level(sf::RenderWindow& window) :
-	window(window),
+	camera(&window),
 	ib(&global_textures[ib_texture_name], &window),
 	doodle(doodle_pos),
-	tiles(window),
-	items(window),
-	monsters(window)
+	tiles(camera),
+	items(camera),
+	monsters(camera)
 {
-	Previews::window = &window;
+	init();
+}
+
+Level::Level(sf::Vector2u size) :
+	camera(size),
+	ib(&global_textures[ib_texture_name], sf::FloatRect{ {0, 0}, sf::Vector2f(size) }),
+	doodle(doodle_pos),
+	tiles(camera),
+	items(camera),
+	monsters(camera)
+{
+	init();
+}
+
+void Level::init()
+{
+	m_previous_view_center = camera.getView().getCenter();
 
 	//create level scene
 	scene.addObject(ib, []() {});
 	scene.addObject(tiles);
 	auto items_obj = scene.addObject(items);
-	auto doodle_obj = scene.addObject(doodle);
-	auto doodle_dupl_obj = doodle_obj.get_duplicate();
-	doodle_dupl_obj.setUpdate([this]() {doodle.updateForDrawing(); });
+	scene.addObject(doodle);
 	scene.moveObjectUpInUpdateOrder(items_obj);
 	scene.addObject(monsters);
-	scene.addToUpdateList(doodle_dupl_obj);
-	scene.setWindow(&window);
+	//the doodle is updated for drawing after everything, it is drawn only once
+	auto doodle_dupl_obj = scene.addObject(doodle, [this]() {doodle.updateForDrawing(); });
+	scene.removeFromDrawList(doodle_dupl_obj);
+	scene.setCamera(&camera);
 	scene.setScrollingType(InstantScrolling());
 
-	level_generator.setLevelForGeneration(this);
+	level_generator.setLevel(this);
 }
 
 void Level::handleGameEvents(thor::ActionMap<UserActions>& action_map, sf::Time dt)
 {
-	if (action_map.isActive(UserActions::Left))
-		doodle.left(dt);
-	if (action_map.isActive(UserActions::Right))
-		doodle.right(dt);
+	applyInput(resolveInput(action_map), dt);
+}
+
+TickInput Level::resolveInput(thor::ActionMap<UserActions>& action_map) const
+{
+	TickInput input;
+	input.left = action_map.isActive(UserActions::Left);
+	input.right = action_map.isActive(UserActions::Right);
 	if (action_map.isActive(UserActions::Shoot))
 	{
-		sf::Vector2f mouse_pos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+		sf::Vector2f mouse_pos = getMouseCoords();
 		sf::Vector2f doodle_pos = doodle.getPosition();
 		sf::Vector2f shoot_vec = mouse_pos - doodle_pos;
 		float angle = thor::TrigonometricTraits<float>::arcTan2(shoot_vec.y, shoot_vec.x);
 		if (angle > 90) angle -= 360;
-		doodle.shoot(angle + 90);
+		input.shoot_angle = angle + 90;
 	}
-	if (action_map.isActive(UserActions::Die)) doodle.dieShrink(window.mapPixelToCoords(sf::Mouse::getPosition(window)));
-	if (action_map.isActive(UserActions::Ressurect)) doodle.ressurrect({ window.mapPixelToCoords(sf::Mouse::getPosition(window)).x, window.mapPixelToCoords(sf::Vector2i{ window.getSize() } / 2).y });
+	if (action_map.isActive(UserActions::Die)) input.die_position = getMouseCoords();
+	if (action_map.isActive(UserActions::Ressurect)) input.ressurect_position = { getMouseCoords().x, camera.mapPixelToCoords(sf::Vector2i{ camera.getSize() } / 2).y };
+	return input;
+}
+
+void Level::applyInput(const TickInput& input, sf::Time dt)
+{
+	if (input.left) doodle.left(dt);
+	if (input.right) doodle.right(dt);
+	if (input.shoot_angle) doodle.shoot(*input.shoot_angle);
+	if (input.die_position) doodle.dieShrink(*input.die_position);
+	if (input.ressurect_position) doodle.ressurrect(*input.ressurect_position);
 }
 
 void Level::update(sf::Time dt)
 {
+	PROFILE_SCOPE("Level::update");
+
+	//the phases are measured only when asked, so the normal updates do not read the clock
+	using Clock = std::chrono::steady_clock;
+	Clock::time_point phase_start = m_is_measuring_update_phases ? Clock::now() : Clock::time_point{}, update_start = phase_start;
+	auto endPhase = [&](std::chrono::nanoseconds& phase_time)
+	{
+		if (!m_is_measuring_update_phases) return;
+		Clock::time_point now = Clock::now();
+		phase_time = now - phase_start;
+		phase_start = now;
+	};
+
+	m_update_phase_times = UpdatePhaseTimes{};
+	m_previous_view_center = camera.getView().getCenter();
+	//the view the last scrolling (or the window) left, every object of this tick reads it
+	camera.updateSnapshot();
 	level_generator.update();
-	doodle.updateArea(utils::getViewArea(window));
+	endPhase(m_update_phase_times.generation);
+	doodle.updateArea(camera.getSnapshot().view_area);
 	if (!doodle.isDead()) {
-		doodle.updateTiles(tiles);
-		doodle.updateItems(items);
-		doodle.updateMonsters(monsters);
+		collision_world.update(doodle, tiles, items, monsters);
+		endPhase(m_update_phase_times.collisions);
 	}
 	scene.updateObjects(dt);
+	endPhase(m_update_phase_times.objects);
 	if (doodle.isTooHigh()) scene.scrollUp(doodle.getArea().top - doodle.getPosition().y);
-	scene.updateScrolling();
-	ib.update();
+	scene.updateScrolling(dt);
+	if (!isHeadless()) ib.update();
+	endPhase(m_update_phase_times.scrolling);
+	if (m_is_measuring_update_phases) m_update_phase_times.total = Clock::now() - update_start;
 }
 
 void Level::addTile(Tile* tile)
 {
-	tiles.m_tiles.emplace_back(tile);
+	tiles.add(tile);
 }
 
 void Level::addItem(Item* item)
 {
-	items.m_items.emplace_back(item);
+	items.add(item);
 }
 
 void Level::addMonster(Monster* monster)
 {
-	monsters.m_monsters.emplace_back(monster);
+	monsters.add(monster);
 }
 
 void Level::saveToFile(std::string path)
@@ -98,17 +149,54 @@ void Level::loadFromFile(std::string path)
 
 void Level::refresh()
 {
-	doodle.ressurrect(sf::Vector2f{ window.getSize() / 2u });
-	doodle.updateArea(sf::FloatRect{ {0, 0}, sf::Vector2f(window.getSize()) });
+	doodle.ressurrect(sf::Vector2f{ camera.getSize() / 2u });
+	doodle.updateArea(sf::FloatRect{ {0, 0}, sf::Vector2f(camera.getSize()) });
 
-	tiles.m_tiles.clear();
-	items.m_items.clear();
-	monsters.m_monsters.clear();
-	scene.scroll(sf::Vector2f(window.getSize() / 2u) - window.getView().getCenter(), true);
+	tiles.clear();
+	items.clear();
+	monsters.clear();
+	scene.scroll(sf::Vector2f(camera.getSize() / 2u) - camera.getView().getCenter(), true);
 	scene.updateScrolling();
+	m_previous_view_center = camera.getView().getCenter();
 	level_generator.reset();
 }
 
+void Level::setInterpolationAlpha(float alpha)
+{
+	doodle.setInterpolationAlpha(alpha);
+	tiles.setInterpolationAlpha(alpha);
+	items.setInterpolationAlpha(alpha);
+	monsters.setInterpolationAlpha(alpha);
+
+	//only the drawing view is interpolated, the camera keeps the view of the last update
+	if (isHeadless()) return;
+	sf::View view = camera.getView();
+	view.move(utils::getInterpolationOffset(m_previous_view_center, view.getCenter(), alpha));
+	camera.getWindow()->setView(view);
+}
+
+void Level::setMeasuringUpdatePhases(bool measure)
+{
+	m_is_measuring_update_phases = measure;
+}
+
+const Level::UpdatePhaseTimes& Level::getLastUpdatePhaseTimes() const
+{
+	return m_update_phase_times;
+}
+
+bool Level::isHeadless() const
+{
+	return camera.isHeadless();
+}
+
+sf::Vector2f Level::getMouseCoords() const
+{
+	//without a window there is no mouse, so the center of the view is used
+	if (isHeadless()) return camera.getView().getCenter();
+	return camera.mapPixelToCoords(sf::Mouse::getPosition(*camera.getWindow()));
+}
+
 void to_json(nl::json& j, const Level& level)
 {
 	j["ib_texture_name"] = level.ib_texture_name;
@@ -1,10 +1,12 @@
 #pragma once
 #include <string>
+#include <chrono>
 
 #include <SFML/Graphics.hpp>
 #include <Thor/Input.hpp>
 #include <nlohmann/json.hpp>
 
+#include <common/Camera.hpp>
 #include <common/GameStuff.hpp>
 #include <drawables/ImageBackground.hpp>
 #include <drawables/Scene.hpp>
@@ -12,11 +14,19 @@
 #include <gameObjects/Tiles.hpp>
 #include <gameObjects/Items.hpp>
 #include <gameObjects/Monsters.hpp>
+#include <gameObjects/CollisionWorld.hpp>
 #include <level/LevelGenerator.hpp>
+#include <level/InputRecording.hpp>
 
 struct Level
 {
-	sf::RenderWindow& window;
+	//how long the phases of an update took
+	struct UpdatePhaseTimes
+	{
+		std::chrono::nanoseconds generation{}, collisions{}, objects{}, scrolling{}, total{};
+	};
+
+	Camera camera;
 
 	std::string ib_texture_name = "background";
 	ImageBackground ib;
@@ -26,13 +36,19 @@ struct Level
 	Tiles tiles;
 	Items items;
 	Monsters monsters;
+	CollisionWorld collision_world;
 
 	Scene scene;
 
 	LevelGenerator level_generator{};
 
 	Level(sf::RenderWindow& window);
+	//headless level, it is simulated without any window (drawing it is not supported)
+	Level(sf::Vector2u size);
 	void handleGameEvents(thor::ActionMap<UserActions>& action_map, sf::Time dt);
+	//handleGameEvents in two steps, so the resolved input can be recorded and replayed (see InputRecording)
+	TickInput resolveInput(thor::ActionMap<UserActions>& action_map) const;
+	void applyInput(const TickInput& input, sf::Time dt);
 	void update(sf::Time dt);
 	void addTile(Tile* tile);
 	void addItem(Item* item);
@@ -42,7 +58,24 @@ struct Level
 	void loadFromFile(std::string path);
 	void refresh();
 
+	//sets where between the previous and the current update the level is drawn (see FixedTimestep)
+	void setInterpolationAlpha(float alpha);
+
+	//measuring is off by default, when it is off the times are zero
+	void setMeasuringUpdatePhases(bool measure);
+	const UpdatePhaseTimes& getLastUpdatePhaseTimes() const;
+
+	bool isHeadless() const;
+
 	friend void to_json(nl::json& j, const Level& level);
 	friend void from_json(const nl::json& j, Level& level);
+
+private:
+	void init();
+	sf::Vector2f getMouseCoords() const;
+
+	sf::Vector2f m_previous_view_center{};
+	bool m_is_measuring_update_phases{ false };
+	UpdatePhaseTimes m_update_phase_times{};
 };
 
@@ -2,8 +2,8 @@
 #include "LevelGenerator.hpp"
 #include <ranges>
 #include <algorithm>
+#include <random>
 
-#include <Thor/Math.hpp>
 #include <common/Utils.hpp>
 #include <imgui.h>
 
@@ -12,7 +12,7 @@
 
 #define TEXT(x) #x
 
-float Generation::generateImpl(float generated_height, float left, float right)
+float Generation::generateImpl(GenerationContext& context, float generated_height, float left, float right)
 {
 	return 0.0f;
 }
@@ -21,30 +21,24 @@ void Generation::toImGuiImpl()
 {
 }
 
-float Generation::drawPreviewImpl(sf::Vector2f offset) const
+float Generation::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
 	return 0.f;
 }
 
-float Generation::drawSubGenerationsPreview(sf::Vector2f offset) const
+float Generation::drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const
 {
 	return 0.f;
 }
 
-Generation::Generation():
-	ImGui_id(++ImGui_id_counter)
+float Generation::generate(GenerationContext& context, float generated_height, float left, float right)
 {
-}
-
-float Generation::generate(float generated_height, float left, float right)
-{
-	if (!level) return 0.0f;
-	else return generateImpl(generated_height, left, right);
+	return generateImpl(context, generated_height, left, right);
 }
 
 void Generation::toImGui()
 {
-	if (ImGui::TreeNodeEx(std::format("{}##{}", getName(), ImGui_id).c_str(), ImGuiTreeNodeFlags_DefaultOpen))
+	if (ImGui::TreeNodeEx(std::format("{}##{}", getName(), (uintptr_t)this).c_str(), ImGuiTreeNodeFlags_DefaultOpen))
 	{
 		bool canPrev = canPreview();
 		if (!canPrev) ImGui::Text("Can't preview");
@@ -59,20 +53,10 @@ bool Generation::canPreview() const
 	return false;
 }
 
-float Generation::drawPreview(sf::Vector2f offset) const
-{
-	if (!preview) return drawSubGenerationsPreview(offset);
-	return drawPreviewImpl(offset);
-}
-
-void Generation::setCurrentLevelForGenerating(Level* level)
+float Generation::drawPreview(const Previews& previews, sf::Vector2f offset) const
 {
-	Generation::level = level;
-}
-
-Level* Generation::getCurrentLevelForGenerating()
-{
-	return level;
+	if (!preview) return drawSubGenerationsPreview(previews, offset);
+	return drawPreviewImpl(previews, offset);
 }
 
 
@@ -129,13 +113,16 @@ LevelGenerator::LevelGenerator():
 
 void LevelGenerator::reset()
 {
-	if (Level* level = getLevelForGeneration(); level) m_generated_height = level->window.getSize().y;
+	if (m_level) m_generated_height = m_level->camera.getSize().y;
 	else m_generated_height = 1000;
+	std::random_device device;
+	m_random.seed(m_seed.value_or((uint64_t(device()) << 32) | device()));
 	m_generator = getGenerator();
 }
 
 void LevelGenerator::update()
 {
+	if (!m_level) return;
 	while (true)
 	{
 		m_generating_area = getGeneratingArea();
@@ -158,29 +145,57 @@ float LevelGenerator::getGeneratedHeight()
 	return m_generated_height;
 }
 
+void LevelGenerator::setSeed(std::optional<uint64_t> seed)
+{
+	m_seed = seed;
+}
+
+std::optional<uint64_t> LevelGenerator::getSeed() const
+{
+	return m_seed;
+}
+
+uint64_t LevelGenerator::getCurrentSeed() const
+{
+	return m_random.getSeed();
+}
+
+RandomEngine& LevelGenerator::getRandom()
+{
+	return m_random;
+}
+
 void LevelGenerator::toImGui()
 {
 	if (ImGui::TreeNodeEx("Level Generator", ImGuiTreeNodeFlags_DefaultOpen))
 	{
 		ImGui::Text("Settings:"); ImGui::SameLine(); m_settings.toImGui();
+		bool has_seed = m_seed.has_value();
+		if (ImGui::Checkbox("Fixed seed", &has_seed)) m_seed = has_seed ? std::optional<uint64_t>(getCurrentSeed()) : std::nullopt;
+		if (m_seed)
+		{
+			ImGui::SameLine();
+			ImGui::InputScalar(std::format("##{}", (uintptr_t)&m_seed).c_str(), ImGuiDataType_U64, &*m_seed);
+		}
+		else ImGui::Text("Current seed: %llu", (unsigned long long)getCurrentSeed());
 		::toImGui<Generation>(m_generation, "Generation:");
 		ImGui::TreePop();
 	}
 }
 
-void LevelGenerator::setLevelForGeneration(Level * level_ptr)
+void LevelGenerator::setLevel(Level* level)
 {
-	Generation::setCurrentLevelForGenerating(level_ptr);
+	m_level = level;
 }
 
-Level* LevelGenerator::getLevelForGeneration()
+Level* LevelGenerator::getLevel() const
 {
-	return Generation::getCurrentLevelForGenerating();
+	return m_level;
 }
 
 sf::FloatRect LevelGenerator::getGeneratingArea()
 {
-	sf::FloatRect area{ utils::getViewArea(getLevelForGeneration()->window) };
+	sf::FloatRect area{ m_level->camera.getSnapshot().view_area };
 	if (m_generated_height > area.top + area.height) m_generated_height = area.top + area.height;
 	area.top -= area.height / 2;
 	area.height = m_generated_height - area.top;
@@ -191,7 +206,8 @@ LevelGenerator::Generator LevelGenerator::getGenerator()
 {
 	for (int i = 0; m_settings.repeate_count == -1 || i < m_settings.repeate_count; i++)
 	{
-		float height = (m_generation ? m_generation->generate(m_generated_height, m_generating_area.left, m_generating_area.left + m_generating_area.width) : 0.f);
+		GenerationContext context{ *m_level, m_random };
+		float height = (m_generation ? m_generation->generate(context, m_generated_height, m_generating_area.left, m_generating_area.left + m_generating_area.width) : 0.f);
 		height = std::max(1.f, height);
 		m_generated_height -= height;
 		co_await std::suspend_always{};
@@ -202,28 +218,30 @@ void to_json(nl::json& j, const LevelGenerator& level_generator)
 {
 	j["generation_settings"] = level_generator.m_settings;
 	j["generation"] = level_generator.m_generation;
+	if (level_generator.m_seed) j["seed"] = *level_generator.m_seed;
 }
 
 void from_json(const nl::json& j, LevelGenerator& level_generator)
 {
 	if(j.contains("generation_settings")) j["generation_settings"].get_to(level_generator.m_settings);
 	if (j.contains("generation")) j["generation"].get_to(level_generator.m_generation);
+	level_generator.m_seed = j.contains("seed") ? std::optional<uint64_t>(j["seed"].get<uint64_t>()) : std::nullopt;
 }
 
 
 
-float TileGeneration::generateImpl(float generated_height, float left, float right)
+float TileGeneration::generateImpl(GenerationContext& context, float generated_height, float left, float right)
 {
-	float height = height_returner ? height_returner->getValue() : 0.0f;
-	sf::Vector2f position = position_returner ? position_returner->getValue() : sf::Vector2f{};
-	Tile* tile = getTile();
+	float height = height_returner ? height_returner->getValue(context) : 0.0f;
+	sf::Vector2f position = position_returner ? position_returner->getValue(context) : sf::Vector2f{};
+	Tile* tile = getTile(context);
 	if (!tile) return height;
 	tile->setPosition(position.x, generated_height - position.y);
-	getCurrentLevelForGenerating()->addTile(tile);
+	context.level.addTile(tile);
 	if (item_generation)
 	{
 		item_generation->tile = tile;
-		item_generation->generate(generated_height, left, right);
+		item_generation->generate(context, generated_height, left, right);
 	}
 	return height;
 }
@@ -236,28 +254,28 @@ void TileGeneration::toImGuiImpl()
 	::toImGui<ItemGeneration>(item_generation, "Item:");
 }
 
-Tile* TileGeneration::getTile()
+Tile* TileGeneration::getTile(GenerationContext& context)
 {
 	return nullptr;
 }
 
-float TileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float TileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
 	float mean_height = 0.f;
-	if(item_generation) mean_height += item_generation->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(position_returner) position_returner->drawPreview(offset);
-	if(height_returner) height_returner->drawPreview({ offset.x + (position_returner ? position_returner->getMeanValue() : sf::Vector2f{}).x, offset.y });
+	if(item_generation) mean_height += item_generation->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(position_returner) position_returner->drawPreview(previews, offset);
+	if(height_returner) height_returner->drawPreview(previews, { offset.x + (position_returner ? position_returner->getMeanValue() : sf::Vector2f{}).x, offset.y });
 	mean_height += (height_returner ? height_returner->getMeanValue() : 0.f);
-	return mean_height + Generation::drawPreviewImpl(offset);
+	return mean_height + Generation::drawPreviewImpl(previews, offset);
 }
 
 
 
-float ItemGeneration::generateImpl(float, float, float)
+float ItemGeneration::generateImpl(GenerationContext& context, float, float, float)
 {
-	Item* item = getItem();
+	Item* item = getItem(context);
 	if (!item) return 0.0f;
-	getCurrentLevelForGenerating()->addItem(item);
+	context.level.addItem(item);
 	return 0.0f;
 }
 
@@ -267,26 +285,26 @@ void ItemGeneration::toImGuiImpl()
 	::toImGui<Returner<XOffset>>(tile_offset_returner, "Tile offset:");
 }
 
-Item* ItemGeneration::getItem()
+Item* ItemGeneration::getItem(GenerationContext& context)
 {
 	return nullptr;
 }
 
-float ItemGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float ItemGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	if(tile_offset_returner) tile_offset_returner->drawPreview(offset);
-	return Generation::drawPreviewImpl(offset);
+	if(tile_offset_returner) tile_offset_returner->drawPreview(previews, offset);
+	return Generation::drawPreviewImpl(previews, offset);
 }
 
 
 
-float MonsterGeneration::generateImpl(float generated_height, float, float)
+float MonsterGeneration::generateImpl(GenerationContext& context, float generated_height, float, float)
 {
-	Monster* monster = getMonster();
+	Monster* monster = getMonster(context);
 	if (!monster) return 0.0f;
-	sf::Vector2f position = position_returner ? position_returner->getValue() : sf::Vector2f{};
+	sf::Vector2f position = position_returner ? position_returner->getValue(context) : sf::Vector2f{};
 	monster->setPosition(position.x, generated_height - position.y);
-	getCurrentLevelForGenerating()->addMonster(monster);
+	context.level.addMonster(monster);
 	return 0.0f;
 }
 
@@ -296,39 +314,39 @@ void MonsterGeneration::toImGuiImpl()
 	::toImGui<Returner<Position>>(position_returner, "Position:");
 }
 
-Monster* MonsterGeneration::getMonster()
+Monster* MonsterGeneration::getMonster(GenerationContext& context)
 {
 	return nullptr;
 }
 
-float MonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float MonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	if(position_returner) position_returner->drawPreview(offset);
-	return Generation::drawPreviewImpl(offset);
+	if(position_returner) position_returner->drawPreview(previews, offset);
+	return Generation::drawPreviewImpl(previews, offset);
 }
 
 
 
-Tile* NormalTileGeneration::getTile()
+Tile* NormalTileGeneration::getTile(GenerationContext& context)
 {
 	auto* tile = new NormalTile;
 	return tile;
 }
 
-float NormalTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float NormalTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_normal"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_normal").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	return TileGeneration::drawPreviewImpl(offset);
+	previews.window->draw(tile);
+	return TileGeneration::drawPreviewImpl(previews, offset);
 }
 
-Tile* HorizontalSlidingTileGeneration::getTile()
+Tile* HorizontalSlidingTileGeneration::getTile(GenerationContext& context)
 {
-	auto* tile = new HorizontalSlidingTile(speed_returner ? speed_returner->getValue() : 0.0f);
-	tile->updateMovingLocation(left_returner ? left_returner->getValue() : 0.0f, right_returner ? right_returner->getValue() : 0.0f);
+	auto* tile = new HorizontalSlidingTile(speed_returner ? speed_returner->getValue(context) : 0.0f);
+	tile->updateMovingLocation(left_returner ? left_returner->getValue(context) : 0.0f, right_returner ? right_returner->getValue(context) : 0.0f);
 	return tile;
 }
 
@@ -340,24 +358,24 @@ void HorizontalSlidingTileGeneration::toImGuiImpl()
 	::toImGui<Returner<XBoundary>>(right_returner, "Right Boundary:");
 }
 
-float HorizontalSlidingTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float HorizontalSlidingTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_horizontal"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_horizontal").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	float mean_height = TileGeneration::drawPreviewImpl(offset);
-	if(speed_returner) speed_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(left_returner) left_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(right_returner) right_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	previews.window->draw(tile);
+	float mean_height = TileGeneration::drawPreviewImpl(previews, offset);
+	if(speed_returner) speed_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(left_returner) left_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(right_returner) right_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	return mean_height;
 }
 
-Tile* VerticalSlidingTileGeneration::getTile()
+Tile* VerticalSlidingTileGeneration::getTile(GenerationContext& context)
 {
-	auto* tile = new VerticalSlidingTile(speed_returner ? speed_returner->getValue() : 0.0f);
-	tile->updateMovingLocation(top_returner ? top_returner->getValue() : 0.0f, bottom_returner ? bottom_returner->getValue() : 0.0f);
+	auto* tile = new VerticalSlidingTile(speed_returner ? speed_returner->getValue(context) : 0.0f);
+	tile->updateMovingLocation(top_returner ? top_returner->getValue(context) : 0.0f, bottom_returner ? bottom_returner->getValue(context) : 0.0f);
 	return tile;
 }
 
@@ -369,24 +387,24 @@ void VerticalSlidingTileGeneration::toImGuiImpl()
 	::toImGui<Returner<YBoundary>>(bottom_returner, "Bottom Boundary:");
 }
 
-float VerticalSlidingTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float VerticalSlidingTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_vertical"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_vertical").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	float mean_height = TileGeneration::drawPreviewImpl(offset);
-	if(speed_returner) speed_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(top_returner) top_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(bottom_returner) bottom_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	previews.window->draw(tile);
+	float mean_height = TileGeneration::drawPreviewImpl(previews, offset);
+	if(speed_returner) speed_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(top_returner) top_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(bottom_returner) bottom_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	return mean_height;
 }
 
-Tile* DecayedTileGeneration::getTile()
+Tile* DecayedTileGeneration::getTile(GenerationContext& context)
 {
-	auto* tile = new DecayedTile(speed_returner ? speed_returner->getValue() : 0.0f);
-	tile->updateMovingLocation(left_returner ? left_returner->getValue() : 0.0f, right_returner ? right_returner->getValue() : 0.0f);
+	auto* tile = new DecayedTile(speed_returner ? speed_returner->getValue(context) : 0.0f);
+	tile->updateMovingLocation(left_returner ? left_returner->getValue(context) : 0.0f, right_returner ? right_returner->getValue(context) : 0.0f);
 	return tile;
 }
 
@@ -398,24 +416,24 @@ void DecayedTileGeneration::toImGuiImpl()
 	::toImGui<Returner<XBoundary>>(right_returner, "Right Boundary:");
 }
 
-float DecayedTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float DecayedTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_decayed_0"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_decayed_0").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	float mean_height = TileGeneration::drawPreviewImpl(offset);
-	if(speed_returner) speed_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(left_returner) left_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(right_returner) right_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	previews.window->draw(tile);
+	float mean_height = TileGeneration::drawPreviewImpl(previews, offset);
+	if(speed_returner) speed_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(left_returner) left_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(right_returner) right_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	return mean_height;
 }
 
-Tile* BombTileGeneration::getTile()
+Tile* BombTileGeneration::getTile(GenerationContext& context)
 {
-	auto* tile = new BombTile(exploding_height_returner ? exploding_height_returner->getValue() : 0.0f);
-	tile->setSpecUpdate([tile, this](sf::Time) { tile->updateHeight(getCurrentLevelForGenerating()->window); });
+	auto* tile = new BombTile(exploding_height_returner ? exploding_height_returner->getValue(context) : 0.0f);
+	tile->setSpecUpdate([tile, &camera = context.level.camera](sf::Time) { tile->updateHeight(camera); });
 	return tile;
 }
 
@@ -425,38 +443,38 @@ void BombTileGeneration::toImGuiImpl()
 	::toImGui<Returner<Height>>(exploding_height_returner, "Explotion height:");
 }
 
-float BombTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float BombTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_bomb_0"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_bomb_0").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	float mean_height = TileGeneration::drawPreviewImpl(offset);
-	if(exploding_height_returner) exploding_height_returner->drawPreview({ offset.x + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}).x, Previews::window->mapPixelToCoords(sf::Vector2i{ Previews::window->getSize() } / 2).y });
+	previews.window->draw(tile);
+	float mean_height = TileGeneration::drawPreviewImpl(previews, offset);
+	if(exploding_height_returner) exploding_height_returner->drawPreview(previews, { offset.x + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}).x, previews.window->mapPixelToCoords(sf::Vector2i{ previews.window->getSize() } / 2).y });
 	return mean_height;
 }
 
-Tile* OneTimeTileGeneration::getTile()
+Tile* OneTimeTileGeneration::getTile(GenerationContext& context)
 {
 	auto* tile = new OneTimeTile;
 	return tile;
 }
 
-float OneTimeTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float OneTimeTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_one_time"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_one_time").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	return TileGeneration::drawPreviewImpl(offset);
+	previews.window->draw(tile);
+	return TileGeneration::drawPreviewImpl(previews, offset);
 }
 
-Tile* TeleportTileGeneration::getTile()
+Tile* TeleportTileGeneration::getTile(GenerationContext& context)
 {
-	auto* tile = new TeleportTile;
-	for (const auto& returner : offset_returners) tile->addNewPosition(returner ? returner->getValue() : sf::Vector2f{});
+	auto* tile = new TeleportTile(context.random);
+	for (const auto& returner : offset_returners) tile->addNewPosition(returner ? returner->getValue(context) : sf::Vector2f{});
 	return tile;
 }
 
@@ -490,29 +508,29 @@ void TeleportTileGeneration::toImGuiImpl()
 	}
 }
 
-float TeleportTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float TeleportTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_teleport_0"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_teleport_0").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	float mean_height = TileGeneration::drawPreviewImpl(offset);
+	previews.window->draw(tile);
+	float mean_height = TileGeneration::drawPreviewImpl(previews, offset);
 	tile.setColor(sf::Color(255, 255, 255, 128));
 	for (size_t i = 0; i < offset_returners.size(); i++)
 	{
 		const auto& returner = offset_returners[i];
 		tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}) + utils::yFlipped(returner ? returner->getMeanValue() : sf::Vector2f{}));
-		Previews::window->draw(tile);
-		if(returner) returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+		previews.window->draw(tile);
+		if(returner) returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	}
 	return mean_height;
 }
 
-Tile* ClusterTileGeneration::getTile()
+Tile* ClusterTileGeneration::getTile(GenerationContext& context)
 {
-	auto* tile = new ClusterTile(id);
-	for (const auto& returner : offset_returners) tile->addNewPosition(returner ? returner->getValue() : sf::Vector2f{});
+	auto* tile = new ClusterTile(id, context.level.tiles.getClusters());
+	for (const auto& returner : offset_returners) tile->addNewPosition(returner ? returner->getValue(context) : sf::Vector2f{});
 	return tile;
 }
 
@@ -547,99 +565,99 @@ void ClusterTileGeneration::toImGuiImpl()
 	ImGui::Text("Id:"); ImGui::SameLine(); id.toImGui();
 }
 
-float ClusterTileGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float ClusterTileGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite tile = global_sprites["tiles_cluster"].createSprite();
+	sf::Sprite tile = global_sprites.at("tiles_cluster").createSprite();
 	tile.setScale(0.65, 0.65);
 	tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	tile.setOrigin(64, 20);
-	Previews::window->draw(tile);
-	float mean_height = TileGeneration::drawPreviewImpl(offset);
+	previews.window->draw(tile);
+	float mean_height = TileGeneration::drawPreviewImpl(previews, offset);
 	tile.setColor(sf::Color(255, 255, 255, 128));
 	for (size_t i = 0; i < offset_returners.size(); i++)
 	{
 		const auto& returner = offset_returners[i];
 		tile.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}) + utils::yFlipped(returner ? returner->getMeanValue() : sf::Vector2f{}));
-		Previews::window->draw(tile);
-		if(returner) returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+		previews.window->draw(tile);
+		if(returner) returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	}
 	return mean_height;
 }
 
 
 
-Item* SpringGeneration::getItem()
+Item* SpringGeneration::getItem(GenerationContext& context)
 {
 	auto* item = new Spring(tile);
-	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue() : 0.0f);
+	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue(context) : 0.0f);
 	return item;
 }
 
-float SpringGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float SpringGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite item = global_sprites["items_spring_0"].createSprite();
+	sf::Sprite item = global_sprites.at("items_spring_0").createSprite();
 	item.setScale(0.65, 0.65);
 	item.setPosition(offset + sf::Vector2f{ (tile_offset_returner ? tile_offset_returner->getMeanValue() : 0.0f), -14 });
 	item.setOrigin(17, 12);
-	Previews::window->draw(item);
-	return ItemGeneration::drawPreviewImpl(offset);
+	previews.window->draw(item);
+	return ItemGeneration::drawPreviewImpl(previews, offset);
 }
 
-Item* TrampolineGeneration::getItem()
+Item* TrampolineGeneration::getItem(GenerationContext& context)
 {
 	auto* item = new Trampoline(tile);
-	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue() : 0.0f);
+	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue(context) : 0.0f);
 	return item;
 }
 
-float TrampolineGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float TrampolineGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite item = global_sprites["items_trampoline_0"].createSprite();
+	sf::Sprite item = global_sprites.at("items_trampoline_0").createSprite();
 	item.setScale(0.65, 0.65);
 	item.setPosition(offset + sf::Vector2f{ (tile_offset_returner ? tile_offset_returner->getMeanValue() : 0.0f), -16 });
 	item.setOrigin(36, 14);
-	Previews::window->draw(item);
-	return ItemGeneration::drawPreviewImpl(offset);
+	previews.window->draw(item);
+	return ItemGeneration::drawPreviewImpl(previews, offset);
 }
 
-Item* PropellerHatGeneration::getItem()
+Item* PropellerHatGeneration::getItem(GenerationContext& context)
 {
 	auto* item = new PropellerHat(tile);
-	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue() : 0.0f);
+	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue(context) : 0.0f);
 	return item;
 }
 
-float PropellerHatGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float PropellerHatGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite item = global_sprites["items_propeller_hat_0"].createSprite();
+	sf::Sprite item = global_sprites.at("items_propeller_hat_0").createSprite();
 	item.setScale(0.65, 0.65);
 	item.setPosition(offset + sf::Vector2f{ (tile_offset_returner ? tile_offset_returner->getMeanValue() : 0.0f), -20 });
 	item.setOrigin(29, 19);
-	Previews::window->draw(item);
-	return ItemGeneration::drawPreviewImpl(offset);
+	previews.window->draw(item);
+	return ItemGeneration::drawPreviewImpl(previews, offset);
 }
 
-Item* JetpackGeneration::getItem()
+Item* JetpackGeneration::getItem(GenerationContext& context)
 {
 	auto* item = new Jetpack(tile);
-	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue() : 0.0f);
+	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue(context) : 0.0f);
 	return item;
 }
 
-float JetpackGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float JetpackGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite item = global_sprites["items_jetpack_1"].createSprite();
+	sf::Sprite item = global_sprites.at("items_jetpack_1").createSprite();
 	item.setScale(0.65, 0.65);
 	item.setPosition(offset + sf::Vector2f{ (tile_offset_returner ? tile_offset_returner->getMeanValue() : 0.0f), -30 });
 	item.setOrigin(24, 36);
-	Previews::window->draw(item);
-	return ItemGeneration::drawPreviewImpl(offset);
+	previews.window->draw(item);
+	return ItemGeneration::drawPreviewImpl(previews, offset);
 }
 
-Item* SpringShoesGeneration::getItem()
+Item* SpringShoesGeneration::getItem(GenerationContext& context)
 {
-	auto* item = new SpringShoes(tile, max_use_count_returner ? max_use_count_returner->getValue() : 0u, &getCurrentLevelForGenerating()->tiles, &getCurrentLevelForGenerating()->monsters);
-	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue() : 0.0f);
+	auto* item = new SpringShoes(tile, max_use_count_returner ? max_use_count_returner->getValue(context) : 0u, &context.level.tiles, &context.level.monsters);
+	item->setOffsetFromTile(tile_offset_returner ? tile_offset_returner->getValue(context) : 0.0f);
 	return item;
 }
 
@@ -649,22 +667,22 @@ void SpringShoesGeneration::toImGuiImpl()
 	::toImGui<Returner<SizeTValue>>(max_use_count_returner, "Max use count:");
 }
 
-float SpringShoesGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float SpringShoesGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite item = global_sprites["items_spring_shoes_3"].createSprite();
+	sf::Sprite item = global_sprites.at("items_spring_shoes_3").createSprite();
 	item.setScale(0.65, 0.65);
 	item.setPosition(offset + sf::Vector2f{ (tile_offset_returner ? tile_offset_returner->getMeanValue() : 0.0f), -24 });
 	item.setOrigin(26, 14);
-	Previews::window->draw(item);
-	return ItemGeneration::drawPreviewImpl(offset);
+	previews.window->draw(item);
+	return ItemGeneration::drawPreviewImpl(previews, offset);
 }
 
 
 
-Monster* BlueOneEyedMonsterGeneration::getMonster()
+Monster* BlueOneEyedMonsterGeneration::getMonster(GenerationContext& context)
 {
-	auto* monster = new BlueOneEyedMonster(speed_returner ? speed_returner->getValue() : 0.0f);
-	monster->updateMovingLocation(left_returner ? left_returner->getValue() : 0.0f, right_returner ? right_returner->getValue() : 0.0f);
+	auto* monster = new BlueOneEyedMonster(speed_returner ? speed_returner->getValue(context) : 0.0f);
+	monster->updateMovingLocation(left_returner ? left_returner->getValue(context) : 0.0f, right_returner ? right_returner->getValue(context) : 0.0f);
 	return monster;
 }
 
@@ -676,173 +694,173 @@ void BlueOneEyedMonsterGeneration::toImGuiImpl()
 	::toImGui<Returner<XBoundary>>(right_returner, "Right Boundary:");
 }
 
-float BlueOneEyedMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float BlueOneEyedMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_blue_one_eyed"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_blue_one_eyed").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(37, 49);
-	Previews::window->draw(monster);
-	float mean_height = MonsterGeneration::drawPreviewImpl(offset);
-	if(speed_returner) speed_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(left_returner) left_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(right_returner) right_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	previews.window->draw(monster);
+	float mean_height = MonsterGeneration::drawPreviewImpl(previews, offset);
+	if(speed_returner) speed_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(left_returner) left_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(right_returner) right_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	return mean_height;
 }
 
-Monster* CamronMonsterGeneration::getMonster()
+Monster* CamronMonsterGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new CamronMonster;
 	return monster;
 }
 
-float CamronMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float CamronMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_camron"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_camron").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(44, 35);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* PurpleSpiderMonsterGeneration::getMonster()
+Monster* PurpleSpiderMonsterGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new PurpleSpiderMonster;
 	return monster;
 }
 
-float PurpleSpiderMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float PurpleSpiderMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_purple_spider"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_purple_spider").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(55, 49);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* LargeBlueMonsterGeneration::getMonster()
+Monster* LargeBlueMonsterGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new LargeBlueMonster;
 	return monster;
 }
 
-float LargeBlueMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float LargeBlueMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_large_blue"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_large_blue").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(85, 106);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* UFOGeneration::getMonster()
+Monster* UFOGeneration::getMonster(GenerationContext& context)
 {
-	auto* monster = new UFO;
+	auto* monster = new UFO(context.random.fork());
 	return monster;
 }
 
-float UFOGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float UFOGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_ufo_0"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_ufo_0").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(78, 34);
-	sf::Sprite light = global_sprites["monsters_ufo_1"].createSprite();
+	sf::Sprite light = global_sprites.at("monsters_ufo_1").createSprite();
 	light.setOrigin(80, 0);
 	light.setPosition(monster.getPosition());
 	light.setScale(monster.getScale());
-	Previews::window->draw(light);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(light);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* BlackHoleGeneration::getMonster()
+Monster* BlackHoleGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new BlackHole;
 	return monster;
 }
 
-float BlackHoleGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float BlackHoleGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_black_hole"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_black_hole").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(70, 65);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* OvalGreenMonsterGeneration::getMonster()
+Monster* OvalGreenMonsterGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new OvalGreenMonster;
 	return monster;
 }
 
-float OvalGreenMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float OvalGreenMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_oval_green_0"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_oval_green_0").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(62, 168);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* FlatGreenMonsterGeneration::getMonster()
+Monster* FlatGreenMonsterGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new FlatGreenMonster;
 	return monster;
 }
 
-float FlatGreenMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float FlatGreenMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_flat_green_0"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_flat_green_0").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(91, 62);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* LargeGreenMonsterGeneration::getMonster()
+Monster* LargeGreenMonsterGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new LargeGreenMonster;
 	return monster;
 }
 
-float LargeGreenMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float LargeGreenMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_large_green_0"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_large_green_0").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(81, 102);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* BlueWingedMonsterGeneration::getMonster()
+Monster* BlueWingedMonsterGeneration::getMonster(GenerationContext& context)
 {
 	auto* monster = new BlueWingedMonster;
 	return monster;
 }
 
-float BlueWingedMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float BlueWingedMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_blue_winged_0"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_blue_winged_0").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(78, 44);
-	Previews::window->draw(monster);
-	return MonsterGeneration::drawPreviewImpl(offset);
+	previews.window->draw(monster);
+	return MonsterGeneration::drawPreviewImpl(previews, offset);
 }
 
-Monster* TheTerrifyingMonsterGeneration::getMonster()
+Monster* TheTerrifyingMonsterGeneration::getMonster(GenerationContext& context)
 {
-	auto* monster = new TheTerrifyingMonster(speed_returner ? speed_returner->getValue() : sf::Vector2f{});
-	monster->updateMovingLocation(left_returner ? left_returner->getValue() : 0.0f, right_returner ? right_returner->getValue() : 0.0f);
+	auto* monster = new TheTerrifyingMonster(speed_returner ? speed_returner->getValue(context) : sf::Vector2f{});
+	monster->updateMovingLocation(left_returner ? left_returner->getValue(context) : 0.0f, right_returner ? right_returner->getValue(context) : 0.0f);
 	return monster;
 }
 
@@ -854,26 +872,26 @@ void TheTerrifyingMonsterGeneration::toImGuiImpl()
 	::toImGui<Returner<XBoundary>>(right_returner, "Right Boundary:");
 }
 
-float TheTerrifyingMonsterGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float TheTerrifyingMonsterGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	sf::Sprite monster = global_sprites["monsters_the_terrifying_0"].createSprite();
+	sf::Sprite monster = global_sprites.at("monsters_the_terrifying_0").createSprite();
 	monster.setScale(0.65, 0.65);
 	monster.setPosition(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	monster.setOrigin(63, 87);
-	Previews::window->draw(monster);
-	float mean_height = MonsterGeneration::drawPreviewImpl(offset);
-	if(speed_returner) speed_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(left_returner) left_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
-	if(right_returner) right_returner->drawPreview(offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	previews.window->draw(monster);
+	float mean_height = MonsterGeneration::drawPreviewImpl(previews, offset);
+	if(speed_returner) speed_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(left_returner) left_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
+	if(right_returner) right_returner->drawPreview(previews, offset + utils::yFlipped(position_returner ? position_returner->getMeanValue() : sf::Vector2f{}));
 	return mean_height;
 }
 
 
 
-float GenerationWithChance::generateImpl(float generated_height, float left, float right)
+float GenerationWithChance::generateImpl(GenerationContext& context, float generated_height, float left, float right)
 {
 	if (!generation) return 0.0f;
-	if (utils::getTrueWithChance(chance_returner ? chance_returner->getValue() : 0.0f)) return (generation ? generation->generate(generated_height, left, right) : 0.f);
+	if (utils::getTrueWithChance(context.random, chance_returner ? chance_returner->getValue(context) : 0.0f)) return (generation ? generation->generate(context, generated_height, left, right) : 0.f);
 	return 0.0f;
 
 }
@@ -885,24 +903,24 @@ void GenerationWithChance::toImGuiImpl()
 	::toImGui<Returner<Chance>>(chance_returner, "Chance:");
 }
 
-float GenerationWithChance::drawPreviewImpl(sf::Vector2f offset) const
+float GenerationWithChance::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
-	if (generation) return generation->drawPreview(offset);
+	if (generation) return generation->drawPreview(previews, offset);
 	return 0.f;
 }
 
-float GenerationWithChance::drawSubGenerationsPreview(sf::Vector2f offset) const
+float GenerationWithChance::drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const
 {
-	if (generation) return generation->drawPreview(offset);
+	if (generation) return generation->drawPreview(previews, offset);
 	return 0.f;
 }
 
-float GroupGeneration::generateImpl(float generated_height, float left, float right)
+float GroupGeneration::generateImpl(GenerationContext& context, float generated_height, float left, float right)
 {
 	float max_height = 0.0f;
 	for (auto& generation : generations) if (generation)
 	{
-		float height = generation->generate(generated_height, left, right);
+		float height = generation->generate(context, generated_height, left, right);
 		max_height = std::max(max_height, height);
 	}
 	return max_height;
@@ -934,24 +952,24 @@ void GroupGeneration::toImGuiImpl()
 	}
 }
 
-float GroupGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float GroupGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
 	float max_mean_height = 0.f;
-	for (const auto& gen : generations) if (gen) max_mean_height = std::max(max_mean_height, gen->drawPreview(offset));
+	for (const auto& gen : generations) if (gen) max_mean_height = std::max(max_mean_height, gen->drawPreview(previews, offset));
 	return max_mean_height;
 }
 
-float GroupGeneration::drawSubGenerationsPreview(sf::Vector2f offset) const
+float GroupGeneration::drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const
 {
 	float sum_mean_height = 0.0f;
-	for (const auto& gen : generations) if (gen) sum_mean_height += gen->drawPreview(offset - sf::Vector2f{ 0, sum_mean_height });
+	for (const auto& gen : generations) if (gen) sum_mean_height += gen->drawPreview(previews, offset - sf::Vector2f{ 0, sum_mean_height });
 	return sum_mean_height;
 }
 
-float ConsecutiveGeneration::generateImpl(float generated_height, float left, float right)
+float ConsecutiveGeneration::generateImpl(GenerationContext& context, float generated_height, float left, float right)
 {
 	float sum_height = 0.0f;
-	for (auto& generation : generations) if (generation) sum_height += generation->generate(generated_height - sum_height, left, right);
+	for (auto& generation : generations) if (generation) sum_height += generation->generate(context, generated_height - sum_height, left, right);
 	return sum_height;
 }
 
@@ -981,17 +999,17 @@ void ConsecutiveGeneration::toImGuiImpl()
 	}
 }
 
-float ConsecutiveGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float ConsecutiveGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
 	float sum_mean_height = 0.0f;
-	for (const auto& gen : generations) if (gen) sum_mean_height += gen->drawPreview(offset - sf::Vector2f{ 0, sum_mean_height });
+	for (const auto& gen : generations) if (gen) sum_mean_height += gen->drawPreview(previews, offset - sf::Vector2f{ 0, sum_mean_height });
 	return sum_mean_height;
 }
 
-float ConsecutiveGeneration::drawSubGenerationsPreview(sf::Vector2f offset) const
+float ConsecutiveGeneration::drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const
 {
 	float sum_mean_height = 0.0f;
-	for (const auto& gen : generations) if (gen) sum_mean_height += gen->drawPreview(offset - sf::Vector2f{ 0, sum_mean_height });
+	for (const auto& gen : generations) if (gen) sum_mean_height += gen->drawPreview(previews, offset - sf::Vector2f{ 0, sum_mean_height });
 	return sum_mean_height;
 }
 
@@ -1005,11 +1023,11 @@ void PickOneGeneration::ProbabilityGenerationPair::toImGui()
 	}
 }
 
-float PickOneGeneration::generateImpl(float generated_height, float left, float right)
+float PickOneGeneration::generateImpl(GenerationContext& context, float generated_height, float left, float right)
 {
-	std::deque<float> chances = generations | std::views::transform([](const ProbabilityGenerationPair& val) { return val.relative_probability_returner ? val.relative_probability_returner->getValue() : 0.0f; }) | std::ranges::to<std::deque>();
-	size_t pair_ind = utils::pickOneWithRelativeProbabilities(chances);
-	if (generations[pair_ind].generation) return generations[pair_ind].generation->generate(generated_height, left, right);
+	std::deque<float> chances = generations | std::views::transform([&context](const ProbabilityGenerationPair& val) { return val.relative_probability_returner ? val.relative_probability_returner->getValue(context) : 0.0f; }) | std::ranges::to<std::deque>();
+	size_t pair_ind = utils::pickOneWithRelativeProbabilities(context.random, chances);
+	if (generations[pair_ind].generation) return generations[pair_ind].generation->generate(context, generated_height, left, right);
 	return 0.0f;
 }
 
@@ -1043,15 +1061,15 @@ void PickOneGeneration::toImGuiImpl()
 	}
 }
 
-float PickOneGeneration::drawPreviewImpl(sf::Vector2f offset) const
+float PickOneGeneration::drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const
 {
 	return 0.0f;
 }
 
-float PickOneGeneration::drawSubGenerationsPreview(sf::Vector2f offset) const
+float PickOneGeneration::drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const
 {
 	float sum_mean_height = 0.0f;
-	for (const auto& pair : generations) if (pair.generation) sum_mean_height += pair.generation->drawPreview(offset - sf::Vector2f{ 0, sum_mean_height });
+	for (const auto& pair : generations) if (pair.generation) sum_mean_height += pair.generation->drawPreview(previews, offset - sf::Vector2f{ 0, sum_mean_height });
 	return sum_mean_height;
 }
 
@@ -7,6 +7,7 @@
 #include <utility>
 #include <typeinfo>
 #include <fstream>
+#include <optional>
 
 #include <imgui.h>
 #include <misc/cpp/imgui_stdlib.h>
@@ -18,28 +19,23 @@
 #include <gameObjects/Monsters.hpp>
 #include <common/Utils.hpp>
 #include <common/Returners.hpp>
+#include <common/Random.hpp>
 #include <DoodleJumpConfig.hpp>
 
 
 class Level;
 class Generation
 {
-	inline static Level* level = nullptr;
-	size_t ImGui_id{ 0 };
-	inline static size_t ImGui_id_counter = 0;
-
 protected:
-	virtual float generateImpl(float generated_height, float left, float right);
+	virtual float generateImpl(GenerationContext& context, float generated_height, float left, float right);
 	virtual void toImGuiImpl();
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
-	virtual float drawSubGenerationsPreview(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
+	virtual float drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const;
 
 public:
-	Generation();
-	float generate(float generated_height, float left, float right); // returns the height of the generation
-	static void setCurrentLevelForGenerating(Level* level);
-	static Level* getCurrentLevelForGenerating();
+	Generation() = default;
+	float generate(GenerationContext& context, float generated_height, float left, float right); // returns the height of the generation
 	
 	virtual std::string getName() const;
 
@@ -50,7 +46,7 @@ public:
 	bool preview = true;
 	virtual bool canPreview() const;
 	
-	float drawPreview(sf::Vector2f offset = sf::Vector2f{}) const;
+	float drawPreview(const Previews& previews, sf::Vector2f offset = sf::Vector2f{}) const;
 };
 
 class LevelGenerator
@@ -101,6 +97,9 @@ private:
 	std::unique_ptr<Generation> m_generation{};
 	float m_generated_height{1000};
 	sf::FloatRect m_generating_area{};
+	std::optional<uint64_t> m_seed{};
+	RandomEngine m_random{};
+	Level* m_level{ nullptr };
 
 public:
 	LevelGenerator();
@@ -115,10 +114,18 @@ public:
 	void setGenerationSettings(GenerationSettings settings);
 	float getGeneratedHeight();
 
+	//with no seed set, a new random seed is picked on every reset
+	void setSeed(std::optional<uint64_t> seed);
+	std::optional<uint64_t> getSeed() const;
+	//the seed the current generation was started with
+	uint64_t getCurrentSeed() const;
+	RandomEngine& getRandom();
+
 	void toImGui();
 
-	static void setLevelForGeneration(Level* level_ptr);
-	static Level* getLevelForGeneration();
+	//the level the tiles, items and monsters are generated for
+	void setLevel(Level* level);
+	Level* getLevel() const;
 
 private:
 	sf::FloatRect getGeneratingArea();
@@ -144,11 +151,11 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	float generateImpl(float generated_height, float left, float right) override;
+	float generateImpl(GenerationContext& context, float generated_height, float left, float right) override;
 	virtual void toImGuiImpl() override;
-	virtual Tile* getTile();
+	virtual Tile* getTile(GenerationContext& context);
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class ItemGeneration : public Generation
@@ -165,11 +172,11 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	float generateImpl(float, float, float) override;
+	float generateImpl(GenerationContext& context, float, float, float) override;
 	virtual void toImGuiImpl() override;
-	virtual Item* getItem();
+	virtual Item* getItem(GenerationContext& context);
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class MonsterGeneration : public Generation
@@ -185,11 +192,11 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	float generateImpl(float generated_height, float, float) override;
+	float generateImpl(GenerationContext& context, float generated_height, float, float) override;
 	virtual void toImGuiImpl() override;
-	virtual Monster* getMonster();
+	virtual Monster* getMonster(GenerationContext& context);
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 
@@ -205,9 +212,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class HorizontalSlidingTileGeneration : public TileGeneration
@@ -225,10 +232,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class VerticalSlidingTileGeneration : public TileGeneration
@@ -246,10 +253,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class DecayedTileGeneration : public TileGeneration
@@ -267,10 +274,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class BombTileGeneration : public TileGeneration
@@ -286,10 +293,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class OneTimeTileGeneration : public TileGeneration
@@ -303,9 +310,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class TeleportTileGeneration : public TileGeneration
@@ -321,10 +328,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class ClusterTileGeneration : public TileGeneration
@@ -341,10 +348,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Tile* getTile() override;
+	virtual Tile* getTile(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 
@@ -360,9 +367,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Item* getItem() override;
+	virtual Item* getItem(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class TrampolineGeneration: public ItemGeneration
@@ -376,9 +383,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Item* getItem() override;
+	virtual Item* getItem(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class PropellerHatGeneration : public ItemGeneration
@@ -392,9 +399,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Item* getItem() override;
+	virtual Item* getItem(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class JetpackGeneration : public ItemGeneration
@@ -408,9 +415,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Item* getItem() override;
+	virtual Item* getItem(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class SpringShoesGeneration : public ItemGeneration
@@ -426,10 +433,10 @@ public:
 	virtual bool canPreview() const override;
 
  protected:
-	virtual Item* getItem() override;
+	virtual Item* getItem(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 
@@ -449,10 +456,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class CamronMonsterGeneration : public MonsterGeneration
@@ -466,9 +473,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class PurpleSpiderMonsterGeneration : public MonsterGeneration
@@ -482,9 +489,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
  
 class LargeBlueMonsterGeneration : public MonsterGeneration
@@ -498,9 +505,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class UFOGeneration : public MonsterGeneration
@@ -514,9 +521,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class BlackHoleGeneration : public MonsterGeneration
@@ -530,9 +537,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class OvalGreenMonsterGeneration : public MonsterGeneration
@@ -546,9 +553,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class FlatGreenMonsterGeneration : public MonsterGeneration
@@ -562,9 +569,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class LargeGreenMonsterGeneration : public MonsterGeneration
@@ -578,9 +585,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class BlueWingedMonsterGeneration : public MonsterGeneration
@@ -594,9 +601,9 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class TheTerrifyingMonsterGeneration : public MonsterGeneration
@@ -614,10 +621,10 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual Monster* getMonster() override;
+	virtual Monster* getMonster(GenerationContext& context) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 };
 
 
@@ -636,12 +643,12 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual float generateImpl(float generated_height, float left, float right) override;
+	virtual float generateImpl(GenerationContext& context, float generated_height, float left, float right) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 	
-	virtual float drawSubGenerationsPreview(sf::Vector2f offset) const;
+	virtual float drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class GroupGeneration : public Generation
@@ -657,12 +664,12 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual float generateImpl(float generated_height, float left, float right) override;
+	virtual float generateImpl(GenerationContext& context, float generated_height, float left, float right) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 	
-	virtual float drawSubGenerationsPreview(sf::Vector2f offset) const;
+	virtual float drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class ConsecutiveGeneration : public Generation
@@ -678,12 +685,12 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual float generateImpl(float generated_height, float left, float right) override;
+	virtual float generateImpl(GenerationContext& context, float generated_height, float left, float right) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 	
-	virtual float drawSubGenerationsPreview(sf::Vector2f offset) const;
+	virtual float drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const;
 };
 
 class PickOneGeneration : public Generation
@@ -707,12 +714,12 @@ public:
 	virtual bool canPreview() const override;
 
 protected:
-	virtual float generateImpl(float generated_height, float left, float right) override;
+	virtual float generateImpl(GenerationContext& context, float generated_height, float left, float right) override;
 	virtual void toImGuiImpl() override;
 
-	virtual float drawPreviewImpl(sf::Vector2f offset) const;
+	virtual float drawPreviewImpl(const Previews& previews, sf::Vector2f offset) const;
 	
-	virtual float drawSubGenerationsPreview(sf::Vector2f offset) const;
+	virtual float drawSubGenerationsPreview(const Previews& previews, sf::Vector2f offset) const;
 };
 
 template <std::derived_from<Generation> T>
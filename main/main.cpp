@@ -1,8 +1,10 @@
 #include <iostream>
+#include <utility>
 
 #include <SFML/Graphics.hpp>
 
 #include <imgui.h>
+#include <misc/cpp/imgui_stdlib.h>
 #include <SFML/imgui-SFML.h>
 
 #include <Thor/Input.hpp>
@@ -16,10 +18,15 @@
 #include <common/DebugImGui.hpp>
 #include <common/Utils.hpp>
 #include <common/GameStuff.hpp>
+#include <common/FixedTimestep.hpp>
+#include <common/Profiler.hpp>
+#include <common/SpriteBatch.hpp>
+#include <common/ObjectPool.hpp>
 #include <drawables/ImageBackground.hpp>
 #include <drawables/Scene.hpp>
 #include <level/Level.hpp>
 #include <level/LevelGenerator.hpp>
+#include <level/InputRecording.hpp>
 #include <gameObjects/Doodle.hpp>
 #include <gameObjects/Tiles.hpp>
 #include <gameObjects/Items.hpp>
@@ -71,11 +78,23 @@ int main()
 	sf::Clock deltaClock;
 	sf::Time full_time, dt;
 	float game_speed{ 1 };
+	FixedTimestep timestep;
+	//the one time inputs (shooting, dying, ressurecting) of the frames that ran no tick, the next tick that runs gets them
+	TickInput pending_input{};
 
 	float dragging_speed = 100;
 
+	//input recording (the recordings are played with the Replay program)
+	InputRecorder recorder;
+	std::string recording_path = "recording.djr";
+
+	//the frames are profiled from the start, the profiler window can disable it
+	Profiler::get().setEnabled(true);
+
 	while (window.isOpen())
 	{
+		Profiler::get().beginFrame();
+
 		//event handling
 		action_map.clearEvents();
 		sf::Event event;
@@ -104,15 +123,20 @@ int main()
 		//updating
 
 		frame_count++;
-		full_time += (dt = deltaClock.restart() * game_speed);
+		dt = deltaClock.restart();
+		full_time += dt * game_speed;
+		size_t ticks_count = timestep.addFrameTime(dt * game_speed);
 
 		
 		ImGui::SFML::Update(window, dt);
 		ImGui::Begin("Info");
 		ImGui::Text("Frame count: %d", frame_count);
 		ImGui::Text("FPS: %f", ImGui::GetIO().Framerate);
+		ImGui::Text("Batched draw calls: %zu", SpriteBatch::getStats().draw_calls);
+		ImGui::Text("Sprites drawn/culled: %zu/%zu", SpriteBatch::getStats().drawn_sprites, SpriteBatch::getStats().culled_sprites);
 		ImGui::DragFloat("Drag speed", &dragging_speed, 1, 0.f, 10000.f, "%.3f", ImGuiSliderFlags_Logarithmic);
 		ImGui::DragFloat("Game speed", &game_speed, 1, 0.f, 10000.f, "%.3f", ImGuiSliderFlags_Logarithmic);
+		timestep.toImGui();
 		sf::Vector2f position = level.doodle.getPosition();
 		ImGui::DragFloat2("Position", (float*)&position, dragging_speed);
 		level.doodle.setPosition(position);
@@ -126,13 +150,30 @@ int main()
 		ImGui::SameLine();
 		if (ImGui::SmallButton("Play"))
 		{
+			recorder.stop();
 			level.loadFromFile(std::format(RESOURCES_PATH"Levels/level{}.json", current_level));
 			level.refresh();
 		}
+
+		if (!recorder.isRecording() && ImGui::SmallButton("Record")) recorder.start(level, timestep.getTickTime());
+		else if (recorder.isRecording() && ImGui::SmallButton("Stop recording")) recorder.stop();
+		ImGui::SameLine();
+		ImGui::Text("Recorded ticks: %zu", recorder.getRecording().ticks.size());
+		ImGui::InputText("##Recording path", &recording_path);
+		ImGui::SameLine();
+		if (ImGui::SmallButton("Save recording")) recorder.getRecording().saveToFile(recording_path);
 		
 		//if (ImGui::IsWindowFocused())  dt = sf::Time::Zero;
 		ImGui::End();
 
+		ImGui::Begin("Profiler");
+		Profiler::get().toImGui();
+		ImGui::End();
+
+		ImGui::Begin("Object pools");
+		ObjectPool::statisticsToImGui();
+		ImGui::End();
+
 		if (action_map.isActive(UserActions::Close))
 			window.close();
 		if (action_map.isActive(UserActions::Resize))
@@ -147,18 +188,41 @@ int main()
 			int debug = 0;
 		}
 
-		level.handleGameEvents(action_map, dt);
-		level.update(dt);
+		//the simulation runs in fixed ticks, the drawing is interpolated between the last two of them
+		//a recording is only valid with the tick time and the view size it was started with
+		if (recorder.isRecording() && (recorder.getRecording().tick_time != timestep.getTickTime() || recorder.getRecording().view_size != level.camera.getView().getSize())) recorder.stop();
+		TickInput frame_input = level.resolveInput(action_map);
+		if (frame_input.shoot_angle) pending_input.shoot_angle = frame_input.shoot_angle;
+		if (frame_input.die_position) pending_input.die_position = frame_input.die_position;
+		if (frame_input.ressurect_position) pending_input.ressurect_position = frame_input.ressurect_position;
+		for (size_t i = 0; i < ticks_count; i++)
+		{
+			//the held inputs are read for every tick, the one time ones are handled only once
+			TickInput input = level.resolveInput(action_map);
+			input.shoot_angle = std::exchange(pending_input.shoot_angle, std::nullopt);
+			input.die_position = std::exchange(pending_input.die_position, std::nullopt);
+			input.ressurect_position = std::exchange(pending_input.ressurect_position, std::nullopt);
+			recorder.record(input);
+			level.applyInput(input, timestep.getTickTime());
+			level.update(timestep.getTickTime());
+		}
+		level.setInterpolationAlpha(timestep.getAlpha());
 
 		points_text.setPosition(window.mapPixelToCoords({ 10, 10 }));
 		points_text.setString(std::to_string(int(-window.mapPixelToCoords({ 0, 0 }).y)));
 	
 		//drawing
 		window.clear();
+		SpriteBatch::resetStats();
 		window.draw(level.scene);
 		window.draw(points_text);
-		ImGui::SFML::Render(window);
+		{
+			PROFILE_SCOPE("ImGui::SFML::Render");
+			ImGui::SFML::Render(window);
+		}
 		window.display();
+
+		Profiler::get().endFrame();
 	}
 
 
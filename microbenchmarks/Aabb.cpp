@@ -0,0 +1,63 @@
+#include <iostream>
+#include <format>
+#include <vector>
+#include <algorithm>
+
+#include <SFML/Graphics.hpp>
+
+#include <common/Random.hpp>
+#include <common/Utils.hpp>
+#include <common/BoxArray.hpp>
+
+#include "Microbenchmarks.hpp"
+
+//N tile sized boxes in a column like a generated level, queried by doodle sized boxes
+void runAabbBenchmark(size_t boxes_count, uint64_t seed)
+{
+	const size_t QUERIES_COUNT = 1000, REPEATS_COUNT = 20;
+	RandomEngine random(seed);
+	float height = std::max(boxes_count * 4.f, 800.f);
+	std::vector<sf::FloatRect> boxes(boxes_count), queries(QUERIES_COUNT);
+	BoxArray box_array;
+	box_array.reserve(boxes_count);
+	for (auto& box : boxes)
+	{
+		box = sf::FloatRect(random.uniform(0.f, 426.f), random.uniform(-height, 0.f), 74, 20);
+		box_array.push_back(box);
+	}
+	for (auto& query : queries) query = sf::FloatRect(random.uniform(0.f, 460.f), random.uniform(-height, 0.f), 40, 50);
+
+	std::cout << std::format("{} boxes, {} queries, best kernel: {}\n", boxes_count, QUERIES_COUNT, BoxArray::getKernelName(BoxArray::getBestKernel()));
+	printTableHeader({ "method", "per query (ns)", "per box (ns)", "hits per repeat" });
+	double queries_count = double(QUERIES_COUNT * REPEATS_COUNT);
+	auto print = [&](const char* name, std::chrono::duration<double> elapsed, size_t hits_count)
+	{
+		printTableRow(name, { nanosecondsPer(elapsed, queries_count), nanosecondsPer(elapsed, queries_count * boxes_count), double(hits_count / REPEATS_COUNT) });
+	};
+
+	std::vector<size_t> indices;
+	for (BoxArray::Kernel kernel : { BoxArray::Kernel::Scalar, BoxArray::Kernel::SSE2, BoxArray::Kernel::AVX2 })
+	{
+		if (kernel > BoxArray::getBestKernel()) continue;
+		size_t hits_count = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (size_t repeat = 0; repeat < REPEATS_COUNT; repeat++)
+			for (const auto& query : queries)
+			{
+				indices.clear();
+				box_array.findIntersecting(query, indices, kernel);
+				hits_count += indices.size();
+			}
+		print(BoxArray::getKernelName(kernel), std::chrono::steady_clock::now() - start, hits_count);
+	}
+
+	std::vector<std::pair<size_t, size_t>> pairs;
+	size_t hits_count = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t repeat = 0; repeat < REPEATS_COUNT; repeat++)
+	{
+		utils::findIntersectingPairs(queries, boxes, pairs);
+		hits_count += pairs.size();
+	}
+	print("sort and sweep", std::chrono::steady_clock::now() - start, hits_count);
+}
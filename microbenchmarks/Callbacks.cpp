@@ -0,0 +1,56 @@
+#include <iostream>
+#include <format>
+#include <vector>
+#include <functional>
+
+#include <SFML/System.hpp>
+
+#include <common/InplaceFunction.hpp>
+
+#include "Microbenchmarks.hpp"
+
+//the callbacks of the objects capture the object (most of them) or the object and the camera (the height update of the bomb tiles)
+struct CallbackOwner
+{
+	float value{ 0 };
+	const float* camera{ nullptr };
+	void update(sf::Time dt) { value += dt.asSeconds() + (camera ? *camera : 0); }
+};
+
+template<class Function>
+void runCallbacks(const char* name, std::vector<CallbackOwner>& owners)
+{
+	const size_t REPEATS_COUNT = 100;
+	sf::Time dt = sf::seconds(1.f / 120);
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<Function> callbacks;
+	callbacks.reserve(owners.size());
+	for (size_t i = 0; i < owners.size(); i++)
+	{
+		CallbackOwner* owner = &owners[i];
+		if (i % 2) callbacks.emplace_back([owner](sf::Time dt) { owner->update(dt); });
+		else callbacks.emplace_back([owner, camera = owner->camera](sf::Time dt) { owner->update(dt); (void)camera; });
+	}
+	std::vector<Function> copies = callbacks;
+	std::chrono::duration<double> making_time = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (size_t repeat = 0; repeat < REPEATS_COUNT; repeat++)
+		for (const auto& callback : copies) callback(dt);
+	std::chrono::duration<double> calling_time = std::chrono::steady_clock::now() - start;
+
+	printTableRow(name, { double(sizeof(Function)), nanosecondsPer(making_time, owners.size()), nanosecondsPer(calling_time, owners.size() * REPEATS_COUNT) });
+}
+
+void runCallbacksBenchmark(size_t callbacks_count, uint64_t)
+{
+	std::vector<CallbackOwner> owners(callbacks_count);
+	float camera = 0;
+	for (size_t i = 0; i < callbacks_count; i += 2) owners[i].camera = &camera;
+
+	std::cout << std::format("{} callbacks\n", callbacks_count);
+	printTableHeader({ "type", "size (B)", "make and copy (ns)", "call (ns)" });
+	runCallbacks<std::function<void(sf::Time)>>("std::function", owners);
+	runCallbacks<InplaceFunction<void(sf::Time)>>("InplaceFunction", owners);
+}
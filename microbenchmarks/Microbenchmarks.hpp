@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <initializer_list>
+#include <string>
+
+//every microbenchmark times one part of the game on its own, count is the size of the work (boxes, callbacks, removed objects)
+void runAabbBenchmark(size_t boxes_count, uint64_t seed);
+void runCallbacksBenchmark(size_t callbacks_count, uint64_t seed);
+void runRemovalBenchmark(size_t removed_count, uint64_t seed);
+
+//the results of all the microbenchmarks are printed as one table: a row name and its columns
+void printTableHeader(std::initializer_list<const char*> columns);
+void printTableRow(const std::string& name, std::initializer_list<double> values);
+//the nanoseconds of one unit of work of a timed loop
+double nanosecondsPer(std::chrono::duration<double> elapsed, double units_count);
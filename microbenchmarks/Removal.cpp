@@ -0,0 +1,51 @@
+#include <iostream>
+#include <format>
+
+#include <SFML/Graphics.hpp>
+
+#include <level/Level.hpp>
+#include <gameObjects/Tiles.hpp>
+#include <gameObjects/Monsters.hpp>
+
+#include "Microbenchmarks.hpp"
+
+//N tiles and N monsters below the view, every one between two that stay, so every update removes N objects from the middle of the containers
+void runRemovalBenchmark(size_t removed_count, uint64_t)
+{
+	const size_t REPEATS_COUNT = 20;
+	const sf::Vector2u LEVEL_SIZE{ 500, 800 };
+	std::cout << std::format("{} of {} objects removed in one update\n", removed_count, 2 * removed_count);
+	printTableHeader({ "objects", "update (us)", "per removed (ns)" });
+	auto print = [&](const char* name, std::chrono::duration<double> elapsed)
+	{
+		printTableRow(name, { nanosecondsPer(elapsed, REPEATS_COUNT) / 1000, nanosecondsPer(elapsed, double(REPEATS_COUNT * removed_count)) });
+	};
+
+	std::chrono::duration<double> tiles_time{}, monsters_time{};
+	for (size_t repeat = 0; repeat < REPEATS_COUNT; repeat++)
+	{
+		Level level(LEVEL_SIZE);
+		level.camera.updateSnapshot();
+		sf::FloatRect area = level.camera.getSnapshot().view_area;
+		for (size_t i = 0; i < 2 * removed_count; i++)
+		{
+			sf::Vector2f position{ area.left + area.width / 2, i % 2 ? area.top + area.height + 100 : area.top + area.height / 2 };
+			Tile* tile = new NormalTile();
+			tile->setPosition(position);
+			level.addTile(tile);
+			Monster* monster = new OvalGreenMonster();
+			monster->setPosition(position);
+			level.addMonster(monster);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		level.tiles.update(sf::Time::Zero);
+		tiles_time += std::chrono::steady_clock::now() - start;
+		start = std::chrono::steady_clock::now();
+		level.monsters.update(sf::Time::Zero);
+		monsters_time += std::chrono::steady_clock::now() - start;
+		if (level.tiles.getTilesCount() != removed_count || level.monsters.getMonstersCount() != removed_count) std::cerr << "not every object below the view was removed\n";
+	}
+	print("tiles", tiles_time);
+	print("monsters", monsters_time);
+}
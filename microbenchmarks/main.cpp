@@ -0,0 +1,86 @@
+#include <iostream>
+#include <algorithm>
+#include <format>
+#include <string>
+#include <string_view>
+
+#include <DoodleJumpConfig.hpp>
+#include <common/Resources.hpp>
+#include <common/Random.hpp>
+
+#include "Microbenchmarks.hpp"
+
+//runs one microbenchmark of a part of the game, the Benchmark program is for the phases of whole levels
+//usage: Microbenchmarks <name> N [--seed S]
+
+struct Microbenchmark
+{
+	const char* name;
+	const char* description;
+	//the ones that make game objects need the textures
+	bool needs_resources;
+	void (*run)(size_t count, uint64_t seed);
+};
+
+const Microbenchmark MICROBENCHMARKS[]{
+	{ "aabb", "the BoxArray kernels (and the sort and sweep of utils::findIntersectingPairs) on N tile sized boxes", false, runAabbBenchmark },
+	{ "callbacks", "N object callbacks made, copied and called as std::function and as InplaceFunction", false, runCallbacksBenchmark },
+	{ "removal", "the tiles and monsters updates when N of them fall off the screen at once, between as many that stay", true, runRemovalBenchmark },
+};
+
+void printTableHeader(std::initializer_list<const char*> columns)
+{
+	auto column = columns.begin();
+	std::cout << std::format("{:<20}", *column++);
+	for (; column != columns.end(); column++) std::cout << std::format("{:>20}", *column);
+	std::cout << '\n';
+}
+
+void printTableRow(const std::string& name, std::initializer_list<double> values)
+{
+	std::cout << std::format("{:<20}", name);
+	for (double value : values) std::cout << std::format("{:>20.2f}", value);
+	std::cout << '\n';
+}
+
+double nanosecondsPer(std::chrono::duration<double> elapsed, double units_count)
+{
+	return elapsed.count() * 1e9 / std::max(units_count, 1.0);
+}
+
+void printUsage(const char* program)
+{
+	std::cerr << "usage: " << program << " <name> N [--seed S]\n";
+	for (const auto& microbenchmark : MICROBENCHMARKS) std::cerr << std::format("  {:<12}{}\n", microbenchmark.name, microbenchmark.description);
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 3 && argc != 5)
+	{
+		printUsage(argv[0]);
+		return 1;
+	}
+	uint64_t seed = RandomEngine::default_seed;
+	if (argc == 5)
+	{
+		if (std::string_view(argv[3]) != "--seed")
+		{
+			std::cerr << "unknown option " << argv[3] << '\n';
+			return 1;
+		}
+		seed = std::stoull(argv[4]);
+	}
+
+	for (const auto& microbenchmark : MICROBENCHMARKS)
+	{
+		if (argv[1] != std::string_view(microbenchmark.name)) continue;
+		if (microbenchmark.needs_resources) init_resources(true);
+		microbenchmark.run(std::stoull(argv[2]), seed);
+		if (microbenchmark.needs_resources) release_resources();
+		return 0;
+	}
+	std::cerr << "unknown microbenchmark " << argv[1] << '\n';
+	printUsage(argv[0]);
+	return 1;
+}
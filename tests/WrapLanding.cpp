@@ -0,0 +1,87 @@
+#include <iostream>
+#include <cmath>
+#include <optional>
+
+#include <SFML/Graphics.hpp>
+
+#include <common/Resources.hpp>
+#include <level/Level.hpp>
+
+
+
+//a doodle that falls across the right edge of the screen (and so wraps to the left one) lands on the tile under it,
+//with its feet on the top of the tile, not from below it after falling through
+//the ticks are long, so the doodle falls a lot in one tick
+
+const sf::Vector2u LEVEL_SIZE{ 500, 800 };
+const sf::Time TICK_TIME = sf::seconds(0.1f);
+const sf::Vector2f START_POSITION{ 495, 420 };
+const size_t MAX_TICKS_COUNT = 100;
+
+struct Wrap
+{
+	size_t tick;
+	sf::FloatRect feet_before, feet_after;
+};
+
+//runs the level holding right until the doodle wraps, the level is left just after the wrapping tick
+std::optional<Wrap> runUntilWrap(Level& level)
+{
+	for (size_t tick = 0; tick < MAX_TICKS_COUNT && !level.doodle.isDead(); tick++)
+	{
+		sf::FloatRect feet_before = level.doodle.getFeetCollisionBox();
+		level.applyInput(TickInput{ .right = true }, TICK_TIME);
+		level.update(TICK_TIME);
+		sf::FloatRect feet_after = level.doodle.getFeetCollisionBox();
+		if (tick > 0 && feet_after.left < feet_before.left - LEVEL_SIZE.x / 2.f) return Wrap{ tick, feet_before, feet_after };
+	}
+	return std::nullopt;
+}
+
+int main()
+{
+	init_resources(true);
+	int result = 0;
+	{
+		//the same run without any tile finds where the doodle wraps
+		Level dry_level(LEVEL_SIZE);
+		dry_level.doodle.ressurrect(START_POSITION);
+		std::optional<Wrap> dry_wrap = runUntilWrap(dry_level);
+		if (!dry_wrap)
+		{
+			std::cerr << "the doodle did not get to the edge of the screen\n";
+			return 1;
+		}
+
+		//the top of the tile is halfway between the bottoms of the feet before and after the wrapping tick, under the feet after it
+		float tile_top = (dry_wrap->feet_before.top + dry_wrap->feet_before.height + dry_wrap->feet_after.top + dry_wrap->feet_after.height) / 2;
+
+		Level level(LEVEL_SIZE);
+		level.doodle.ressurrect(START_POSITION);
+		Tile* tile = new NormalTile();
+		tile->setPosition(dry_wrap->feet_after.left + dry_wrap->feet_after.width / 2, tile_top + tile->getCollisionBoxSize().y / 2);
+		level.addTile(tile);
+		std::optional<Wrap> wrap = runUntilWrap(level);
+		if (!wrap || wrap->tick != dry_wrap->tick)
+		{
+			std::cerr << "the run with the tile did not wrap like the one without it\n";
+			return 1;
+		}
+
+		//the landings of the next tick
+		level.collision_world.update(level.doodle, level.tiles, level.items, level.monsters);
+		sf::FloatRect feet = level.doodle.getFeetCollisionBox();
+		if (level.doodle.getVelocity().y >= 0)
+		{
+			std::cerr << "the doodle did not land on the tile\n";
+			result = 1;
+		}
+		else if (std::abs(feet.top + feet.height - tile_top) > 0.5f)
+		{
+			std::cerr << "the doodle landed with its feet at " << feet.top + feet.height << ", not on the top of the tile at " << tile_top << '\n';
+			result = 1;
+		}
+	}
+	release_resources();
+	return result;
+}